@@ -0,0 +1,87 @@
+// Requires node.js. Run with `node replay_diff.js <a.bin> <b.bin>`.
+// Compares two input replays (see user/src/headers/ReplayFile.h): the
+// frame where their player state first differs, and the movement hook's
+// cost per frame on each run.
+
+const fs = require("fs");
+
+const MAGIC = 0x50525347; // "GSRP"
+const VERSION = 1;
+const HEADER_SIZE = 16;
+const FRAME_SIZE = 20;
+const TICK_FREQUENCY = 19200000;
+
+function readReplay(path) {
+    const data = fs.readFileSync(path);
+    if (data.length < HEADER_SIZE || data.readUInt32LE(0) !== MAGIC)
+        throw new Error(`${path}: not a replay`);
+    if (data.readUInt16LE(4) !== VERSION || data.readUInt16LE(6) !== FRAME_SIZE)
+        throw new Error(`${path}: unsupported version ${data.readUInt16LE(4)}`);
+
+    const seed = data.readUInt32LE(8);
+    // A take that never ended has no frame count in the header
+    const storedNum = Math.floor((data.length - HEADER_SIZE) / FRAME_SIZE);
+    const frameNum = data.readUInt32LE(12) ? Math.min(data.readUInt32LE(12), storedNum) : storedNum;
+    const frames = [];
+    for (let i = 0; i < frameNum; i++) {
+        const at = HEADER_SIZE + i * FRAME_SIZE;
+        frames.push({
+            input: data.toString("hex", at, at + 12), // buttons and sticks
+            hash: data.readUInt32LE(at + 12),
+            ticks: data.readUInt32LE(at + 16),
+        });
+    }
+    return { path, seed, frames };
+}
+
+function costStats(frames) {
+    const us = frames.map((frame) => frame.ticks * 1e6 / TICK_FREQUENCY).sort((a, b) => a - b);
+    const at = (q) => us[Math.min(us.length - 1, Math.floor(q * us.length))] || 0;
+    const avg = us.reduce((sum, value) => sum + value, 0) / (us.length || 1);
+    return { avg, p50: at(0.5), p95: at(0.95), max: us[us.length - 1] || 0 };
+}
+
+const hex = (value) => value.toString(16).padStart(8, "0");
+
+if (process.argv.length < 4) {
+    console.log("usage: node replay_diff.js <a.bin> <b.bin>");
+    process.exit(2);
+}
+
+const a = readReplay(process.argv[2]);
+const b = readReplay(process.argv[3]);
+const frameNum = Math.min(a.frames.length, b.frames.length);
+
+console.log(`${a.path}: ${a.frames.length} frames, seed ${hex(a.seed)}`);
+console.log(`${b.path}: ${b.frames.length} frames, seed ${hex(b.seed)}`);
+if (a.seed !== b.seed) console.log("seeds differ, the runs are not the same replay");
+
+let firstInput = -1;
+let firstState = -1;
+let stateDiffs = 0;
+for (let i = 0; i < frameNum; i++) {
+    if (firstInput < 0 && a.frames[i].input !== b.frames[i].input) firstInput = i;
+    if (a.frames[i].hash !== b.frames[i].hash) {
+        if (firstState < 0) firstState = i;
+        stateDiffs++;
+    }
+}
+
+if (firstInput >= 0) console.log(`input differs from frame ${firstInput}`);
+if (firstState < 0) console.log(`state matches on all ${frameNum} frames`);
+else {
+    console.log(`state differs from frame ${firstState} (${stateDiffs} of ${frameNum} frames)`);
+    for (let i = Math.max(0, firstState - 2); i < Math.min(frameNum, firstState + 3); i++)
+        console.log(`  ${String(i).padStart(6)}  ${hex(a.frames[i].hash)}  ${hex(b.frames[i].hash)}`);
+}
+
+// Cost is compared over the frames both runs have
+const costA = costStats(a.frames.slice(0, frameNum));
+const costB = costStats(b.frames.slice(0, frameNum));
+const row = (name, cost) => console.log(`${name.padEnd(4)} avg ${cost.avg.toFixed(1)} us, p50 ${cost.p50.toFixed(1)} us, ` +
+    `p95 ${cost.p95.toFixed(1)} us, max ${cost.max.toFixed(1)} us`);
+console.log("movement hook cost per frame:");
+row("a", costA);
+row("b", costB);
+const delta = costB.avg - costA.avg;
+console.log(`b - a: ${delta >= 0 ? "+" : ""}${delta.toFixed(1)} us (${(costA.avg ? delta / costA.avg * 100 : 0).toFixed(1)}%)`);
@@ -30,4 +30,26 @@
 
 // [ EXTRA: CAPPY EYES ]
 // Disable Cappy eyes.
-#define REMOVE_CAPPY_EYES
\ No newline at end of file
+#define REMOVE_CAPPY_EYES
+
+// [ EXTRA: FROZEN ACTOR CAPACITY ]
+// Enemies that can stay frozen at once.
+#define FROZEN_ACTOR_MAX 32
+
+// [ EXTRA: FROZEN SENSOR LOD ]
+// Update sensors of clipped or far frozen enemies less often.
+#define ALLOW_FROZEN_SENSOR_LOD
+    // Full rate inside this distance from Mario.
+    #define FROZEN_SENSOR_NEAR_RADIUS 3000.0f
+    // Frames between updates beyond it; clipped enemies are suspended.
+    #define FROZEN_SENSOR_FAR_INTERVAL 4
+
+// [ EXTRA: LATENCY TRACE ]
+// Measure frames from spin and fireball presses to their hitboxes.
+// Hold ZL+ZR and press Down to log the histograms.
+//#define ALLOW_LATENCY_TRACE
+
+// [ EXTRA: INPUT REPLAY ]
+// Record pad input and the RNG seed to the SD card and play it back.
+// Set "replay" to "record" or "play" in the config, then hold ZL+ZR and press Up.
+//#define ALLOW_INPUT_REPLAY
\ No newline at end of file
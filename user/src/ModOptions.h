@@ -1,19 +1,27 @@
 #pragma once
 
 #include <mallow/config.hpp>
+#include "headers/PadSnapshot.h"
 
 struct ModOptions : public mallow::config::ConfigBase{
     bool raindowSpin;
     char spinButton;
+    u16 spinButtonMask;  // spinButton as a PadSnapshot button
+    int inputBuffer;  // frames a spin press stays buffered
+    char replay;  // 'r' records input, 'p' plays it back, see Replay.h
 
     void read(const ArduinoJson::JsonObject &config) override {
         mallow::config::ConfigBase::read(config);
         raindowSpin = config["rainbowSpin"] | false;
+        inputBuffer = config["inputBuffer"] | 3;
+        replay = (config["replay"] | "")[0];
         if(!config["spinButton"].is<const char*>()){
             spinButton = 'Y';
+            spinButtonMask = PadSnapshot::toButton(spinButton);
             return;
         }
         const char* buttonStr = config["spinButton"];
         spinButton = buttonStr[0];
+        spinButtonMask = PadSnapshot::toButton(spinButton);
     }
 };
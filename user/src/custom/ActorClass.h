@@ -0,0 +1,45 @@
+#pragma once
+#include "custom/_Globals.h"
+#include "headers/ActorClassTable.h"
+
+namespace ActorClass {
+    // Runtime cache keyed by vtable, so the RTTI name is only looked at
+    // once per class per boot instead of once per contact.
+    struct CacheEntry { const void* vtable; u64 traits; };
+
+    inline constexpr u32 cacheSize = 256;
+    inline CacheEntry cache[cacheSize] = {};
+    inline u32 cacheCount = 0;
+    inline u32 cacheHits = 0;
+    inline u32 cacheMisses = 0;
+
+    inline u64 classify(const al::LiveActor* actor) {
+        if (!actor) return None;
+
+        const void* vtable = *reinterpret_cast<const void* const*>(actor);
+        u32 slot = (u32)(reinterpret_cast<uintptr_t>(vtable) >> 3) & (cacheSize - 1);
+
+        for (u32 i = 0; i < cacheSize; i++, slot = (slot + 1) & (cacheSize - 1)) {
+            CacheEntry& entry = cache[slot];
+            if (entry.vtable == vtable) { cacheHits++; return entry.traits; }
+            if (entry.vtable) continue;
+
+            cacheMisses++;
+            u64 traits = classify(typeid(*actor).name());
+
+            // Keep a quarter of the table free so probes stay short
+            if (cacheCount < cacheSize * 3 / 4) {
+                entry = { vtable, traits };
+                cacheCount++;
+            }
+            return traits;
+        }
+
+        cacheMisses++;
+        return classify(typeid(*actor).name());
+    }
+
+    inline void logCacheStats() {
+        logLine("ActorClass cache: %u classes, %u hits, %u misses", cacheCount, cacheHits, cacheMisses);
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "custom/_Globals.h"
+#include "custom/AnimTraits.h"
+
+namespace AnimRemap {
+
+    // Suit variants swapped in when the game requests the base animation
+    struct Rule {
+        const char* from;
+        const char* to;
+        u32 hash;  // of from
+
+        constexpr Rule(const char* from, const char* to) : from(from), to(to), hash(AnimTraits::calcHash(from)) {}
+    };
+
+    inline constexpr Rule brawlRules[] = {
+        { "WearEnd", "WearEndBrawl" },
+    };
+
+    inline constexpr Rule superRules[] = {
+        { "WearEnd", "WearEndSuper" },
+    };
+
+    inline constexpr Rule punchRules[] = {
+        { "HipDropStart",         "HipDropPunchStart" },
+        { "HipDrop",              "HipDropPunch" },
+        { "HipDropLand",          "HipDropPunchLand" },
+        { "HipDropReaction",      "HipDropPunchReaction" },
+        { "SwimHipDropStart",     "SwimHipDropPunchStart" },
+        { "SwimHipDrop",          "SwimHipDropPunch" },
+        { "SwimDive",             "SwimHipDropPunch" },
+        { "SwimHipDropLand",      "SwimHipDropPunchLand" },
+        { "LandStiffen",          "LandSuper" },
+        { "MofumofuDemoOpening2", "MofumofuDemoOpening2Super" },
+    };
+
+    struct Table {
+        const Rule* rules;
+        s32 count;
+        bool isNeedCape;  // classic Mario only punches while the cape is out
+    };
+
+    template <s32 N>
+    constexpr Table makeTable(const Rule (&rules)[N], bool isNeedCape) { return { rules, N, isNeedCape }; }
+
+    inline constexpr s32 TABLE_MAX = 2;
+    inline Table tables[TABLE_MAX] = {};
+    inline s32 tableCount = 0;
+
+    // Picks the tables for the current suit, after initPlayer set the suit flags
+    inline void init() {
+        tableCount = 0;
+        if (isBrawl) tables[tableCount++] = makeTable(brawlRules, false);
+        if (isSuper) tables[tableCount++] = makeTable(superRules, false);
+        if (isFeather || isBrawl || isSuper) tables[tableCount++] = makeTable(punchRules, false);
+        else if (isMario) tables[tableCount++] = makeTable(punchRules, true);
+    }
+
+    inline const char* find(const char* name) {
+        const u32 hash = AnimTraits::calcHash(name);
+
+        for (s32 t = 0; t < tableCount; t++) {
+            const Table& table = tables[t];
+            if (table.isNeedCape && !(playerParts.cape && al::isAlive(playerParts.cape))) continue;
+
+            for (s32 i = 0; i < table.count; i++) {
+                const Rule& rule = table.rules[i];
+                if (rule.hash == hash && al::isEqualString(rule.from, name)) return rule.to;
+            }
+        }
+        return nullptr;
+    }
+
+    struct PlayerAnimatorStartAnim : public mallow::hook::Trampoline<PlayerAnimatorStartAnim> {
+        static void Callback(PlayerAnimator* thisPtr, const sead::SafeString& animName) {
+            if (!tableCount || !isHakoniwa || thisPtr != isHakoniwa->mAnimator) return Orig(thisPtr, animName);
+
+            const char* remapped = find(animName.cstr());
+            if (remapped) return Orig(thisPtr, sead::SafeString(remapped));
+
+            Orig(thisPtr, animName);
+        }
+    };
+
+    inline void Install() {
+        PlayerAnimatorStartAnim::InstallAtSymbol("_ZN14PlayerAnimator9startAnimERKN4sead14SafeStringBaseIcEE");
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "custom/_Globals.h"
+
+namespace AnimTraits {
+
+    // Animation groups the mod branches on. Recomputed only when the
+    // current animation changes, so predicates are a single bit test.
+    enum Trait : u32 {
+        None             = 0,
+        SpinSeparate     = 1 << 0,  // SpinSeparate, SpinSeparateSwim
+        DoubleSpinGround = 1 << 1,  // SpinAttackLeft/Right
+        DoubleSpinAir    = 1 << 2,  // SpinAttackAirLeft/Right
+        Punch            = 1 << 3,  // Koopa cap punches, RabbitGet, Kick
+        HipDrop          = 1 << 4,  // Hip drops, spin drop falls, swim dive
+        CapeOrTail       = 1 << 5,
+        Glide            = 1 << 6,  // JumpBroad8, Glide
+
+        DoubleSpin = DoubleSpinGround | DoubleSpinAir,
+        SpinAttack = SpinSeparate | CapeOrTail | Glide,
+    };
+
+    struct Entry { const char* name; u32 traits; };
+
+    inline constexpr Entry entries[] = {
+        { "SpinSeparate", SpinSeparate },             { "SpinSeparateSwim", SpinSeparate },
+        { "SpinAttackLeft", DoubleSpinGround },       { "SpinAttackRight", DoubleSpinGround },
+        { "SpinAttackAirLeft", DoubleSpinAir },       { "SpinAttackAirRight", DoubleSpinAir },
+        { "KoopaCapPunchL", Punch },                  { "KoopaCapPunchR", Punch },
+        { "KoopaCapPunchFinishL", Punch },            { "KoopaCapPunchFinishR", Punch },
+        { "RabbitGet", Punch },                       { "Kick", Punch },
+        { "HipDrop", HipDrop },                       { "HipDropPunch", HipDrop },
+        { "HipDropReaction", HipDrop },               { "HipDropPunchReaction", HipDrop },
+        { "SpinJumpDownFallL", HipDrop },             { "SpinJumpDownFallR", HipDrop },
+        { "SwimHipDrop", HipDrop },                   { "SwimHipDropPunch", HipDrop },
+        { "SwimDive", HipDrop },
+        { "CapeAttack", CapeOrTail },                 { "TailAttack", CapeOrTail },
+        { "JumpBroad8", Glide },                      { "Glide", Glide },
+    };
+
+    constexpr u32 calcHash(const char* str) {
+        u32 h = 2166136261u;
+        for (; *str; str++) { h ^= (u8)*str; h *= 16777619u; }
+        return h;
+    }
+
+    inline constexpr int entryCount = sizeof(entries) / sizeof(entries[0]);
+
+    struct HashTable { u32 hashes[entryCount] = {}; };
+
+    consteval HashTable buildTable() {
+        HashTable table;
+        for (int i = 0; i < entryCount; i++) table.hashes[i] = calcHash(entries[i].name);
+        return table;
+    }
+
+    inline constexpr HashTable table = buildTable();
+
+    struct Cache {
+        const PlayerAnimator* animator = nullptr;
+        u32 hash = 0;
+        u32 traits = None;
+    };
+
+    inline Cache cache;
+
+    inline u32 get(const PlayerAnimator* animator) {
+        if (!animator) return None;
+
+        const char* cur = animator->mCurAnim.cstr();
+        u32 hash = calcHash(cur);
+        if (animator == cache.animator && hash == cache.hash) return cache.traits;
+
+        u32 traits = None;
+        for (int i = 0; i < entryCount; i++) {
+            if (table.hashes[i] == hash && al::isEqualString(cur, entries[i].name)) {
+                traits = entries[i].traits;
+                break;
+            }
+        }
+
+        cache = { animator, hash, traits };
+        return traits;
+    }
+
+    inline bool is(const PlayerAnimator* animator, u32 mask) { return get(animator) & mask; }
+}
@@ -0,0 +1,409 @@
+#pragma once
+#include "custom/_Globals.h"
+#include "custom/ActorClass.h"
+#include "custom/FxRegistry.h"
+
+namespace AttackReactions {
+
+    // Weapons a reaction row applies to
+    enum Weapon : u8 {
+        Spin       = 1 << 0,
+        DoubleSpin = 1 << 1,
+        Punch      = 1 << 2,
+        HipDrop    = 1 << 3,
+        Hammer     = 1 << 4,
+        Fireball   = 1 << 5,
+        Iceball    = 1 << 6,
+
+        PlayerWeapons = Spin | DoubleSpin | Punch | HipDrop,
+    };
+
+    // Per-instance traits, stored above the ActorClass bits.
+    // These depend on the model, the hit sensor or the freeze state,
+    // so they are worked out per contact rather than per class.
+    inline constexpr u64 SignBoardNormal  = 1ull << 48;
+    inline constexpr u64 SignBoardOther   = 1ull << 49;
+    inline constexpr u64 TreasureBoxWood  = 1ull << 50;
+    inline constexpr u64 TreasureBoxOther = 1ull << 51;
+    inline constexpr u64 CarBody          = 1ull << 52;  // Car/CarBreakable model, not the Brake sensor
+    inline constexpr u64 KoopaBig         = 1ull << 53;
+    inline constexpr u64 Frozen           = 1ull << 54;
+
+    static_assert((u64)ActorClass::HackCap < SignBoardNormal, "ActorClass traits overlap instance traits");
+
+    enum class Msg : u8 {
+        None,
+        ByugoBlow,
+        CapAttack,
+        CapAttackCollide,
+        CapReflect,
+        CapReflectCollide,
+        CapTouchWall,
+        Explosion,
+        FireBrosFireBallCollide,
+        HackAttack,
+        HammerBrosHammerHackAttack,
+        KoopaCapPunchFinishL,
+        KoopaCapPunchL,
+        KoopaHackPunch,
+        KoopaHackPunchCollide,
+        PlayerFireBallAttack,
+        PlayerHipDrop,
+        PlayerHipDropHipDropSwitch,
+        PlayerObjHipDrop,
+        PlayerObjHipDropReflect,
+        PlayerSpinAttack,
+        PlayerTouchFloorJumpCode,
+        SeedAttackBig,
+        SphinxRideAttackTouchThrough,
+        StatueDrop,
+        TRexAttack,
+        TsukkunThrust,
+        WeaponItemGet,
+    };
+
+    enum class SensorKind : u8 {
+        Any,
+        NpcOrRide,
+        EnemyBody,
+        NotEnemyBody,
+        MapObj,
+        Collision,
+    };
+
+    enum Flag : u8 {
+        PlayerHit = 1 << 0,  // "Hit" on the player unless the source already shows it
+        Unfreeze  = 1 << 1,
+    };
+
+    struct Step {
+        Msg msg = Msg::None;
+        u64 skip = 0;         // targets this message is never sent to
+        bool isQuiet = false; // no SE when this message lands
+    };
+
+    static constexpr s32 MAX_STEPS = 12;
+
+    struct Reaction {
+        u8 weapons = 0;
+        u64 anyOf = 0;        // 0 matches every target
+        u64 noneOf = 0;
+        SensorKind sensor = SensorKind::Any;
+        Step steps[MAX_STEPS] = {};  // tried in order, ends at Msg::None
+        Fx::Effect effect = Fx::Effect::None; // emitted by the source at the hit point
+        u64 noEffect = 0;
+        Fx::Se se = Fx::Se::None;             // started on the player
+        u8 flags = 0;
+    };
+
+    using namespace ActorClass;
+
+    // Rows are tried top to bottom; the first accepted message wins.
+    // Hook-specific reactions (nerve changes, Koopa guard, freezing) stay in code.
+    inline constexpr Reaction table[] = {
+        // Player spin, punch and hip drop
+        { .weapons = PlayerWeapons,
+          .anyOf = BlockHard | BossForestBlock | GolemClimb | MarchingCubeBlock,
+          .steps = { { Msg::HammerBrosHammerHackAttack } } },
+        { .weapons = PlayerWeapons,
+          .anyOf = BreakMapParts | BreakableWall | CatchBomb | DamageBall | KickStone | KoopaDamageBall
+                 | MoonBasement | PlayGuideBoard | SignBoardOther | TreasureBoxWood,
+          .steps = { { Msg::Explosion }, { Msg::StatueDrop }, { Msg::KoopaCapPunchL },
+                     { Msg::KoopaHackPunch }, { Msg::KoopaHackPunchCollide } },
+          .effect = Fx::Effect::Hit },
+        { .weapons = PlayerWeapons,
+          .anyOf = BreedaWanwan | TRex,
+          .steps = { { Msg::PlayerObjHipDropReflect }, { Msg::PlayerHipDrop } } },
+        { .weapons = PlayerWeapons,
+          .anyOf = CarBody | ChurchDoor | CollapseSandHill | Doshi | ReactionObject | SignBoardNormal,
+          .steps = { { Msg::CapReflect }, { Msg::CapAttack }, { Msg::CapAttackCollide },
+                     { Msg::CapReflectCollide }, { Msg::CapTouchWall } } },
+        { .weapons = PlayerWeapons,
+          .anyOf = YoshiFruit,
+          .steps = { { Msg::PlayerObjHipDropReflect } } },
+        { .weapons = PlayerWeapons,
+          .sensor = SensorKind::NpcOrRide,
+          .steps = { { Msg::PlayerSpinAttack }, { Msg::CapReflect }, { Msg::PlayerObjHipDropReflect },
+                     { Msg::CapAttack } },
+          .se = Fx::Se::BlowHit },
+        { .weapons = PlayerWeapons,
+          .sensor = SensorKind::EnemyBody,
+          .steps = { { Msg::HackAttack }, { Msg::CapReflect }, { Msg::CapAttack },
+                     { Msg::PlayerObjHipDropReflect }, { Msg::TsukkunThrust } },
+          .se = Fx::Se::BlowHit },
+        { .weapons = PlayerWeapons,
+          .noneOf = ActorClass::HipDrop | TreasureBox,
+          .sensor = SensorKind::MapObj,
+          .steps = { { Msg::HackAttack }, { Msg::PlayerSpinAttack }, { Msg::CapReflect },
+                     { Msg::PlayerHipDrop }, { Msg::CapAttack }, { Msg::PlayerObjHipDropReflect },
+                     { .msg = Msg::ByugoBlow, .isQuiet = true } },
+          .se = Fx::Se::BlowHit },
+
+        // Hammer
+        { .weapons = Hammer,
+          .anyOf = BlockHard | BossForestBlock | BreakMapParts | CatchBomb | DamageBall | FrailBox
+                 | KoopaDamageBall | MarchingCubeBlock | MoonBasement | PlayGuideBoard | SignBoardOther
+                 | TreasureBox,
+          .steps = { { Msg::Explosion }, { Msg::StatueDrop }, { Msg::KoopaCapPunchL },
+                     { Msg::KoopaHackPunch }, { Msg::KoopaHackPunchCollide } },
+          .effect = Fx::Effect::HammerHit, .noEffect = BossForestBlock },
+        { .weapons = Hammer,
+          .anyOf = ReactionObject,
+          .sensor = SensorKind::Collision,
+          .steps = { { Msg::Explosion }, { Msg::StatueDrop }, { Msg::KoopaCapPunchL },
+                     { Msg::KoopaHackPunch }, { Msg::KoopaHackPunchCollide } },
+          .effect = Fx::Effect::HammerHit },
+        { .weapons = Hammer,
+          .anyOf = CarBody,
+          .steps = { { Msg::PlayerTouchFloorJumpCode }, { Msg::Explosion } },
+          .effect = Fx::Effect::HammerHit },
+        { .weapons = Hammer,
+          .anyOf = CollapseSandHill | Doshi | SignBoardNormal,
+          .steps = { { Msg::CapAttack }, { Msg::CapAttackCollide }, { Msg::CapReflectCollide } } },
+        { .weapons = Hammer,
+          .anyOf = KoopaBig,
+          .steps = { { Msg::KoopaCapPunchFinishL } },
+          .effect = Fx::Effect::KoopaFinishHit },
+        { .weapons = Hammer,
+          .anyOf = TRex,
+          .steps = { { Msg::PlayerHipDrop }, { Msg::SeedAttackBig } },
+          .effect = Fx::Effect::HammerHit },
+        { .weapons = Hammer,
+          .steps = { { Msg::TRexAttack }, { Msg::PlayerHipDrop }, { Msg::PlayerObjHipDrop },
+                     { Msg::PlayerObjHipDropReflect }, { Msg::PlayerHipDropHipDropSwitch }, { Msg::HackAttack },
+                     { Msg::SphinxRideAttackTouchThrough }, { Msg::CapReflect },
+                     { .msg = Msg::CapAttack, .skip = Souvenir },
+                     { .msg = Msg::TsukkunThrust, .skip = ReactionObject },
+                     { Msg::Explosion } } },
+
+        // Ice and fire balls
+        { .weapons = Iceball,
+          .anyOf = Frozen,
+          .sensor = SensorKind::EnemyBody,
+          .steps = { { Msg::PlayerFireBallAttack }, { Msg::HackAttack }, { Msg::Explosion } },
+          .flags = PlayerHit | Unfreeze },
+        { .weapons = Iceball,
+          .sensor = SensorKind::NotEnemyBody,
+          .steps = { { Msg::PlayerFireBallAttack }, { Msg::FireBrosFireBallCollide }, { Msg::WeaponItemGet },
+                     { Msg::ByugoBlow } } },
+        { .weapons = Iceball,
+          .sensor = SensorKind::NotEnemyBody,
+          .steps = { { Msg::HackAttack }, { Msg::Explosion } },
+          .flags = PlayerHit },
+        { .weapons = Fireball,
+          .steps = { { Msg::HackAttack }, { Msg::Explosion } },
+          .flags = PlayerHit },
+    };
+
+    // Class traits plus the instance traits the table needs for this contact
+    inline u64 calcTargetTraits(al::LiveActor* targetHost, al::HitSensor* target) {
+        u64 traits = ActorClass::classify(targetHost);
+
+        if (traits & ActorClass::SignBoard)
+            traits |= al::isModelName(targetHost, "SignBoardNormal") ? SignBoardNormal : SignBoardOther;
+        if (traits & ActorClass::TreasureBox)
+            traits |= al::isModelName(targetHost, "TreasureBoxWood") ? TreasureBoxWood : TreasureBoxOther;
+        if ((traits & ActorClass::Car)
+            && (al::isModelName(targetHost, "Car") || al::isModelName(targetHost, "CarBreakable"))
+            && !al::isSensorName(target, "Brake")) traits |= CarBody;
+        if ((traits & ActorClass::Koopa) && al::isModelName(targetHost, "KoopaBig")) traits |= KoopaBig;
+
+        return traits;
+    }
+
+    // One attack contact. The hit point and the push direction are only
+    // computed the first time a message or an effect asks for them.
+    struct Contact {
+        al::HitSensor* source = nullptr;
+        al::HitSensor* target = nullptr;
+        al::LiveActor* sourceHost = nullptr;
+        al::LiveActor* targetHost = nullptr;
+        u64 traits = 0;
+
+        Contact(al::HitSensor* source, al::HitSensor* target)
+            : source(source), target(target),
+              sourceHost(al::getSensorHost(source)), targetHost(al::getSensorHost(target)) {}
+
+        bool isValid() const { return sourceHost && targetHost; }
+        void classify() { traits = calcTargetTraits(targetHost, target); }
+
+        // Midway between both sensors, lifted a little
+        const sead::Vector3f& getSpawnPos() {
+            if (!isSpawnPos) {
+                spawnPos = (al::getSensorPos(source) + al::getSensorPos(target)) * 0.5f;
+                spawnPos.y += 20.0f;
+                isSpawnPos = true;
+            }
+            return spawnPos;
+        }
+
+        const sead::Vector3f& getFireDir() {
+            if (!isFireDir) {
+                fireDir = al::getTrans(targetHost) - al::getTrans(sourceHost);
+                fireDir.normalize();
+                isFireDir = true;
+            }
+            return fireDir;
+        }
+
+    private:
+        sead::Vector3f spawnPos;
+        sead::Vector3f fireDir;
+        bool isSpawnPos = false;
+        bool isFireDir = false;
+    };
+
+    inline bool isSensorKind(SensorKind kind, al::HitSensor* target) {
+        switch (kind) {
+            case SensorKind::Any:          return true;
+            case SensorKind::NpcOrRide:    return al::isSensorNpc(target) || al::isSensorRide(target);
+            case SensorKind::EnemyBody:    return al::isSensorEnemyBody(target);
+            case SensorKind::NotEnemyBody: return !al::isSensorEnemyBody(target);
+            case SensorKind::MapObj:       return al::isSensorMapObj(target);
+            case SensorKind::Collision:    return al::isSensorCollision(target);
+        }
+        return false;
+    }
+
+    inline bool sendMsg(Msg msg, Contact& c) {
+        al::HitSensor* target = c.target;
+        al::HitSensor* source = c.source;
+
+        switch (msg) {
+            case Msg::None:                         return false;
+            case Msg::ByugoBlow:                    return rs::sendMsgByugoBlow(target, source, sead::Vector3f::zero);
+            case Msg::CapAttack:                    return rs::sendMsgCapAttack(target, source);
+            case Msg::CapAttackCollide:             return rs::sendMsgCapAttackCollide(target, source);
+            case Msg::CapReflect:                   return rs::sendMsgCapReflect(target, source);
+            case Msg::CapReflectCollide:            return rs::sendMsgCapReflectCollide(target, source);
+            case Msg::CapTouchWall:                 return rs::sendMsgCapTouchWall(target, source, sead::Vector3f{0,0,0}, sead::Vector3f{0,0,0});
+            case Msg::Explosion:                    return al::sendMsgExplosion(target, source, nullptr);
+            case Msg::FireBrosFireBallCollide:      return rs::sendMsgFireBrosFireBallCollide(target, source);
+            case Msg::HackAttack:                   return rs::sendMsgHackAttack(target, source);
+            case Msg::HammerBrosHammerHackAttack:   return rs::sendMsgHammerBrosHammerHackAttack(target, source);
+            case Msg::KoopaCapPunchFinishL:         return rs::sendMsgKoopaCapPunchFinishL(target, source);
+            case Msg::KoopaCapPunchL:               return rs::sendMsgKoopaCapPunchL(target, source);
+            case Msg::KoopaHackPunch:               return rs::sendMsgKoopaHackPunch(target, source);
+            case Msg::KoopaHackPunchCollide:        return rs::sendMsgKoopaHackPunchCollide(target, source);
+            case Msg::PlayerFireBallAttack:         return al::sendMsgPlayerFireBallAttack(target, source);
+            case Msg::PlayerHipDrop:                return al::sendMsgPlayerHipDrop(target, source, nullptr);
+            case Msg::PlayerHipDropHipDropSwitch:   return rs::sendMsgPlayerHipDropHipDropSwitch(target, source);
+            case Msg::PlayerObjHipDrop:             return al::sendMsgPlayerObjHipDrop(target, source, nullptr);
+            case Msg::PlayerObjHipDropReflect:      return al::sendMsgPlayerObjHipDropReflect(target, source, nullptr);
+            case Msg::PlayerSpinAttack:             return al::sendMsgPlayerSpinAttack(target, source, nullptr);
+            case Msg::PlayerTouchFloorJumpCode:     return rs::sendMsgPlayerTouchFloorJumpCode(target, source);
+            case Msg::SeedAttackBig:                return rs::sendMsgSeedAttackBig(target, source);
+            case Msg::SphinxRideAttackTouchThrough: return rs::sendMsgSphinxRideAttackTouchThrough(target, source, c.getFireDir(), c.getFireDir());
+            case Msg::StatueDrop:                   return rs::sendMsgStatueDrop(target, source);
+            case Msg::TRexAttack:                   return rs::sendMsgTRexAttack(target, source);
+            case Msg::TsukkunThrust:                return rs::sendMsgTsukkunThrust(target, source, c.getFireDir(), 0, true);
+            case Msg::WeaponItemGet:                return rs::sendMsgWeaponItemGet(target, source);
+        }
+        return false;
+    }
+
+    struct Hit {
+        const Reaction* reaction = nullptr;
+        const Step* step = nullptr;
+        u32 sends = 0;       // dispatches made, accepted or not
+        u32 chainSends = 0;  // dispatches the plain chain would have made
+        bool isMemo = false;
+
+        explicit operator bool() const { return reaction != nullptr; }
+    };
+
+    // Last accepted step per (target class, row). Targets of one class
+    // nearly always accept the same message, so it is sent first; when it
+    // is rejected the whole chain runs in order as without the memo.
+    struct MemoEntry { const void* vtable; u16 row; u8 step; };
+
+    inline constexpr u32 memoSize = 256;
+    inline MemoEntry memo[memoSize] = {};
+    inline u32 memoCount = 0;
+
+    inline void clearMemo() {
+        for (MemoEntry& entry : memo) entry = {};
+        memoCount = 0;
+    }
+
+    inline MemoEntry* findMemo(const void* vtable, u16 row, bool isCreate) {
+        u32 slot = (u32)((reinterpret_cast<uintptr_t>(vtable) >> 3) ^ (row * 0x9E37u)) & (memoSize - 1);
+        for (u32 i = 0; i < memoSize; i++, slot = (slot + 1) & (memoSize - 1)) {
+            MemoEntry& entry = memo[slot];
+            if (entry.vtable == vtable && entry.row == row) return &entry;
+            if (entry.vtable) continue;
+
+            // Keep a quarter of the table free so probes stay short
+            if (!isCreate || memoCount >= memoSize * 3 / 4) return nullptr;
+            entry = { vtable, row, 0 };
+            memoCount++;
+            return &entry;
+        }
+        return nullptr;
+    }
+
+    // Position of step in the chain as the target's traits leave it
+    inline u32 calcOrdinal(const Reaction& r, u8 step, u64 traits) {
+        u32 ordinal = 0;
+        for (u8 i = 0; i <= step; i++)
+            if (!(traits & r.steps[i].skip)) ordinal++;
+        return ordinal;
+    }
+
+    inline Hit resolve(Weapon weapon, Contact& c) {
+        const u64 traits = c.traits;
+        const void* vtable = c.targetHost ? *reinterpret_cast<const void* const*>(c.targetHost) : nullptr;
+        Hit hit;
+
+        for (u16 row = 0; row < sizeof(table) / sizeof(table[0]); row++) {
+            const Reaction& r = table[row];
+            if (!(r.weapons & weapon)) continue;
+            if (r.anyOf && !(traits & r.anyOf)) continue;
+            if (traits & r.noneOf) continue;
+            if (!isSensorKind(r.sensor, c.target)) continue;
+
+            MemoEntry* entry = vtable ? findMemo(vtable, row, false) : nullptr;
+            s32 tried = -1;
+
+            if (entry && !(traits & r.steps[entry->step].skip)) {
+                const Step& step = r.steps[entry->step];
+                hit.sends++;
+                if (sendMsg(step.msg, c)) {
+                    hit.chainSends += calcOrdinal(r, entry->step, traits);
+                    hit.reaction = &r;
+                    hit.step = &step;
+                    hit.isMemo = true;
+                    return hit;
+                }
+                tried = entry->step;
+            }
+
+            for (u8 i = 0; i < MAX_STEPS; i++) {
+                const Step& step = r.steps[i];
+                if (step.msg == Msg::None) break;
+                if (traits & step.skip) continue;
+
+                hit.chainSends++;
+                if (i == tried) continue;  // rejected a moment ago in this same call
+
+                hit.sends++;
+                if (sendMsg(step.msg, c)) {
+                    if (vtable && (entry || (entry = findMemo(vtable, row, true)))) entry->step = i;
+                    hit.reaction = &r;
+                    hit.step = &step;
+                    return hit;
+                }
+            }
+        }
+        return hit;
+    }
+
+    // Effect and SE shared by every row; flags are left to the caller
+    inline void playFeedback(const Hit& hit, Contact& c, al::LiveActor* player) {
+        const Reaction* r = hit.reaction;
+
+        if (r->effect != Fx::Effect::None && !(c.traits & r->noEffect)) Fx::emit(c.sourceHost, r->effect, &c.getSpawnPos());
+        if (r->se != Fx::Se::None && !hit.step->isQuiet) Fx::startSe(player, r->se);
+        if ((r->flags & PlayerHit) && !al::isEffectEmitting(c.sourceHost, "Hit")) Fx::emit(player, Fx::Effect::Hit, &c.getSpawnPos());
+    }
+}
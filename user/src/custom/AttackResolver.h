@@ -0,0 +1,132 @@
+#pragma once
+#include "custom/_Globals.h"
+#include "custom/ActorClass.h"
+#include "custom/AttackReactions.h"
+#include "custom/FxRegistry.h"
+#include "custom/PlayerFreeze.h"
+#include "headers/PlayerIceCube.h"
+
+namespace AttackResolver {
+
+    using AttackReactions::Contact;
+
+    enum ProfileId : u8 {
+        Spin,
+        DoubleSpin,
+        Punch,
+        HipDrop,
+        Hammer,
+        Fireball,
+        Iceball,
+        ProfileNum,
+    };
+
+    // What sets one weapon apart once a contact reaches the shared resolver
+    struct WeaponProfile {
+        const char* name;
+        AttackReactions::Weapon weapon;
+        bool isHitIceCube;         // ice cubes only register the hit
+        s32 freezeFrames;          // > 0: enemies that aren't frozen yet get frozen instead
+        Fx::Effect impactEffect;   // emitted at the target on every hit
+        bool isConsumed;           // the projectile disappears on hit
+    };
+
+    inline constexpr WeaponProfile profiles[ProfileNum] = {
+        { "Spin",       AttackReactions::Spin,       true,  0,    Fx::Effect::None,   false },
+        { "DoubleSpin", AttackReactions::DoubleSpin, true,  0,    Fx::Effect::None,   false },
+        { "Punch",      AttackReactions::Punch,      true,  0,    Fx::Effect::None,   false },
+        { "HipDrop",    AttackReactions::HipDrop,    true,  0,    Fx::Effect::None,   false },
+        { "Hammer",     AttackReactions::Hammer,     false, 0,    Fx::Effect::None,   false },
+        { "Fireball",   AttackReactions::Fireball,   true,  0,    Fx::Effect::None,   false },
+        { "Iceball",    AttackReactions::Iceball,    true,  1800, Fx::Effect::IceHit, true  },
+    };
+
+    struct Stats {
+        u32 contacts = 0;
+        u32 hits = 0;
+        u32 sends = 0;       // every dispatch, including misses
+        u32 hitSends = 0;    // dispatches on contacts that hit
+        u32 chainSends = 0;  // what those hits would have cost without the memo
+        u32 memoHits = 0;    // hits taken by the remembered step
+    };
+
+    inline Stats stats[ProfileNum] = {};
+
+    enum class Result : u8 {
+        None,
+        IceCube,
+        AlreadyHit,
+        Frozen,
+        Hit,
+    };
+
+    inline void playImpact(const WeaponProfile& profile, Contact& c) {
+        if (profile.impactEffect != Fx::Effect::None) Fx::emit(c.sourceHost, profile.impactEffect, &al::getSensorPos(c.target));
+        if (profile.isConsumed) {
+            Fx::emit(c.sourceHost, Fx::Effect::Disappear, &al::getSensorPos(c.source));
+            c.sourceHost->kill();
+        }
+    }
+
+    // Ice cubes and the hit buffer, shared by every weapon.
+    // Returns None when the contact should go on to react().
+    inline Result begin(ProfileId id, Contact& c) {
+        stats[id].contacts++;
+
+        if (profiles[id].isHitIceCube && (c.traits & ActorClass::PlayerIceCube)) {
+            ((PlayerIceCube*)c.targetHost)->markHit();
+            return Result::IceCube;
+        }
+        return hitBuffer.contains(c.targetHost) ? Result::AlreadyHit : Result::None;
+    }
+
+    // Freezing and the reaction table, for a target not hit yet this window
+    inline Result react(ProfileId id, Contact& c, al::LiveActor* player) {
+        const WeaponProfile& profile = profiles[id];
+        Stats& s = stats[id];
+
+        if (profile.freezeFrames > 0 && al::isSensorEnemyBody(c.target)) {
+            if (!PlayerFreeze::isFrozen(c.targetHost)) {
+                hitBuffer.insert(c.targetHost);
+                PlayerFreeze::freezeActor(c.targetHost, profile.freezeFrames);
+                playImpact(profile, c);
+                s.hits++;
+                return Result::Frozen;
+            }
+            c.traits |= AttackReactions::Frozen;
+        }
+
+        AttackReactions::Hit hit = AttackReactions::resolve(profile.weapon, c);
+        s.sends += hit.sends;
+        if (!hit) return Result::None;
+
+        s.hits++;
+        s.hitSends += hit.sends;
+        s.chainSends += hit.chainSends;
+        if (hit.isMemo) s.memoHits++;
+
+        hitBuffer.insert(c.targetHost);
+        if (hit.reaction->flags & AttackReactions::Unfreeze) PlayerFreeze::unfreezeActor(c.targetHost);
+        AttackReactions::playFeedback(hit, c, player);
+        playImpact(profile, c);
+        return Result::Hit;
+    }
+
+    // Whole path for weapons with no special cases of their own
+    inline Result attack(ProfileId id, Contact& c, al::LiveActor* player) {
+        Result result = begin(id, c);
+        return result == Result::None ? react(id, c, player) : result;
+    }
+
+    inline void logStats() {
+        for (int i = 0; i < ProfileNum; i++) {
+            const Stats& s = stats[i];
+            if (!s.contacts) continue;
+
+            logLine("%s: %u contacts, %u hits (%u from memo), %u sends, %.2f sends/hit (%.2f without memo)",
+                profiles[i].name, s.contacts, s.hits, s.memoHits, s.sends,
+                s.hits ? (f32)s.hitSends / s.hits : 0.0f, s.hits ? (f32)s.chainSends / s.hits : 0.0f);
+        }
+        logLine("Reaction memo: %u class rows", AttackReactions::memoCount);
+    }
+}
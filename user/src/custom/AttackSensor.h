@@ -1,6 +1,13 @@
 #pragma once
+#include "ModConfig.h"
 #include "custom/_Globals.h"
 #include "custom/_Nerves.h"
+#include "custom/ActorClass.h"
+#include "custom/AnimTraits.h"
+#include "custom/AttackReactions.h"
+#include "custom/AttackResolver.h"
+#include "custom/BossState.h"
+#include "custom/FxRegistry.h"
 #include "custom/PlayerFreeze.h"
 #include "headers/PlayerIceCube.h"
 
@@ -16,7 +23,7 @@ namespace AttackSensor {
 
             if (!sourceHost || !targetHost) return;
 
-            if (al::isEqualSubString(typeid(*targetHost).name(), "KoopaCap")
+            if ((ActorClass::classify(targetHost) & ActorClass::KoopaCap)
                 && al::isModelName(targetHost, "KoopaCap")) return;
 
             Orig(thisPtr, source, target);
@@ -28,89 +35,58 @@ namespace AttackSensor {
 
             if (!thisPtr || !source || !target) return;
 
-            al::LiveActor* sourceHost = al::getSensorHost(source);
-            al::LiveActor* targetHost = al::getSensorHost(target);
+            AttackReactions::Contact c(source, target);
+            if (!c.isValid()) return;
+            c.classify();
 
-            if (!sourceHost || !targetHost) return;
+            al::LiveActor* sourceHost = c.sourceHost;
+            al::LiveActor* targetHost = c.targetHost;
+            const u64 targetClass = c.traits;
 
-            if (al::isEqualSubString(typeid(*targetHost).name(), "KoopaCap")
+            if ((targetClass & ActorClass::KoopaCap)
                 && al::isModelName(targetHost, "KoopaCap")) return;
             
-            if (!al::isSensorName(source, "GalaxySpin")
-                && !al::isSensorName(source, "DoubleSpin")
-                && !al::isSensorName(source, "Punch")
-                && !al::isSensorName(source, "HipDropKnockDown")
+            if (!sensors.isAttack(source)
             ) {
                 Orig(thisPtr, source, target);
                 return;
             }
 
-            sead::Vector3f sourcePos = al::getSensorPos(source);
-            sead::Vector3f targetPos = al::getSensorPos(target);
-            sead::Vector3f spawnPos = (sourcePos + targetPos) * 0.5f;
-            spawnPos.y += 20.0f;
+            if (al::isActionPlaying(playerParts.model, "MoveSuper")
+                && (targetClass & ActorClass::FireBall)) return;
 
-            sead::Vector3 fireDir = al::getTrans(targetHost) - al::getTrans(sourceHost);
-            fireDir.normalize();
-    
-            if (al::isActionPlaying(thisPtr->mModelHolder->findModelActor("Normal"), "MoveSuper")
-                && al::isEqualSubString(typeid(*targetHost).name(), "FireBall")) return;
-
-            bool isSpinAttack = al::isSensorName(source, "GalaxySpin") && thisPtr->mAnimator
-                    && (al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinSeparate")
-                        || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinSeparateSwim")
-                        || al::isActionPlaying(thisPtr->mModelHolder->findModelActor("Normal"), "MoveSuper")
-                        || al::isEqualString(thisPtr->mAnimator->mCurAnim, "JumpBroad8")
-                        || al::isEqualString(thisPtr->mAnimator->mCurAnim, "Glide")
-                        || al::isEqualString(thisPtr->mAnimator->mCurAnim, "CapeAttack")
-                        || al::isEqualString(thisPtr->mAnimator->mCurAnim, "TailAttack"));
-
-            bool isDoubleSpinAttack = al::isSensorName(source, "DoubleSpin") && thisPtr->mAnimator
-                    && (al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinAttackLeft")
-                        || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinAttackRight")
-                        || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinAttackAirLeft")
-                        || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinAttackAirRight"));
-
-            bool isSpinFallback = isGalaxySpin
-                && (al::isSensorName(source, "GalaxySpin") || al::isSensorName(source, "DoubleSpin"));
-
-            bool isPunchAttack = al::isSensorName(source, "Punch") && thisPtr->mAnimator
-                && (al::isEqualString(thisPtr->mAnimator->mCurAnim, "KoopaCapPunchL")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "KoopaCapPunchR")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "KoopaCapPunchFinishL")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "KoopaCapPunchFinishR")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "RabbitGet")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "Kick"));
-
-            bool isHipDrop = al::isSensorName(source, "HipDropKnockDown") && thisPtr->mAnimator
-                && (al::isEqualString(thisPtr->mAnimator->mCurAnim, "HipDrop")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "HipDropPunch")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "HipDropReaction")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "HipDropPunchReaction")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinJumpDownFallL")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinJumpDownFallR")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SwimHipDrop")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SwimHipDropPunch")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SwimDive"));
-
-            al::HitSensor* foot = al::getHitSensor(thisPtr, "Foot");
-            bool canTrample = rs::isEnableSendTrampleMsg(thisPtr, foot, target);
+            const u32 anim = AnimTraits::get(thisPtr->mAnimator);
+
+            bool isSpinAttack = source == sensors.galaxySpin && thisPtr->mAnimator
+                    && ((anim & AnimTraits::SpinAttack)
+                        || al::isActionPlaying(playerParts.model, "MoveSuper"));
+
+            bool isDoubleSpinAttack = source == sensors.doubleSpin && (anim & AnimTraits::DoubleSpin);
+
+            bool isSpinFallback = spinCtrl.isGalaxy()
+                && (source == sensors.galaxySpin || source == sensors.doubleSpin);
+
+            bool isPunchAttack = source == sensors.punch && (anim & AnimTraits::Punch);
+
+            bool isHipDrop = source == sensors.hipDrop && (anim & AnimTraits::HipDrop);
+
+            bool canTrample = rs::isEnableSendTrampleMsg(thisPtr, sensors.foot, target);
             bool isHipDropAttack = isHipDrop && !canTrample;
 
             if(isSpinAttack || isDoubleSpinAttack 
                 || isPunchAttack || isHipDropAttack
                 || isSpinFallback
             ) {
+                AttackResolver::ProfileId profile = isPunchAttack ? AttackResolver::Punch
+                    : isHipDropAttack ? AttackResolver::HipDrop
+                    : isDoubleSpinAttack ? AttackResolver::DoubleSpin
+                    : AttackResolver::Spin;
+
                 // Handle ice cubes
-                if (al::isEqualSubString(typeid(*targetHost).name(), "PlayerIceCube")) { ((PlayerIceCube*)targetHost)->markHit(); return; }
+                AttackResolver::Result result = AttackResolver::begin(profile, c);
+                if (result == AttackResolver::Result::IceCube) return;
 
-                bool isInHitBuffer = false;
-                for(int i = 0; i < hitBufferCount; i++) {
-                    if(hitBuffer[i] == targetHost) {
-                        isInHitBuffer = true;
-                        break;
-                    }
-                }
+                bool isInHitBuffer = result == AttackResolver::Result::AlreadyHit;
                 if (!targetHost->getNerveKeeper()) return;
 
                 if(targetHost && targetHost->getNerveKeeper()
@@ -122,37 +98,36 @@ namespace AttackSensor {
 
                     if (isPunchAttack && !isPunching
                     ) {
-                        if (al::isEqualSubString(typeid(*targetHost).name(),"Stake")
+                        if ((targetClass & ActorClass::Stake)
                             && sourceNrv == getNerveAt(0x1D36D20)
                         ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
+                            hitBuffer.insert(targetHost);
                             al::setNerve(targetHost, getNerveAt(0x1D36D30));
-                            al::tryEmitEffect(sourceHost, "Hit", &spawnPos);
+                            Fx::emit(sourceHost, Fx::Effect::Hit, &c.getSpawnPos());
                             return;
                         }
-                        if (al::isEqualSubString(typeid(*targetHost).name(),"Radish")
+                        if ((targetClass & ActorClass::Radish)
                             && sourceNrv == getNerveAt(0x1D22B70)
                         ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
+                            hitBuffer.insert(targetHost);
                             al::setNerve(targetHost, getNerveAt(0x1D22BD8));
-                            al::tryEmitEffect(sourceHost, "Hit", &spawnPos);
+                            Fx::emit(sourceHost, Fx::Effect::Hit, &c.getSpawnPos());
                             return;
                         }
-                        if (al::isEqualSubString(typeid(*targetHost).name(),"BossRaidRivet")
+                        if ((targetClass & ActorClass::BossRaidRivet)
                             && sourceNrv == getNerveAt(0x1C5F330)
                         ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
+                            hitBuffer.insert(targetHost);
                             al::setNerve(targetHost, getNerveAt(0x1C5F338));
-                            al::tryEmitEffect(sourceHost, "Hit", &spawnPos);
+                            Fx::emit(sourceHost, Fx::Effect::Hit, &c.getSpawnPos());
                             return;
                         }
-                        if (al::isEqualSubString(typeid(*targetHost).name(), "TreasureBox")
-                            && !al::isModelName(targetHost, "TreasureBoxWood")
+                        if (targetClass & AttackReactions::TreasureBoxOther
                         ) {
                             if (al::sendMsgExplosion(target, source, nullptr)
                             ) {
-                                hitBuffer[hitBufferCount++] = targetHost;
-                                al::tryEmitEffect(sourceHost, "Hit", &spawnPos);
+                                hitBuffer.insert(targetHost);
+                                Fx::emit(sourceHost, Fx::Effect::Hit, &c.getSpawnPos());
                                 return;
                             }
                         }
@@ -160,16 +135,15 @@ namespace AttackSensor {
                 }
                 if (isSpinAttack || isDoubleSpinAttack || isSpinFallback
                 ) {
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "BlockQuestion")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "BlockBrick")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "BossForestBlock")
+                    if (targetClass & (ActorClass::BlockQuestion
+                            | ActorClass::BlockBrick
+                            | ActorClass::BossForestBlock)
                     ) {
                         rs::sendMsgHammerBrosHammerHackAttack(target, source);
                         return;
                     }
                 }
-                if (al::isEqualSubString(typeid(*targetHost).name(), "Koopa")
-                    && al::isModelName(targetHost, "KoopaBig")
+                if (targetClass & AttackReactions::KoopaBig
                 ) {
                     const char* koopaAct = al::getActionName(targetHost);
 
@@ -177,174 +151,50 @@ namespace AttackSensor {
                         && !al::isEqualSubString(koopaAct, "After") && !al::isEqualSubString(koopaAct, "End"))
                         || al::isEqualSubString(koopaAct, "DownLand") || al::isEqualSubString(koopaAct, "Jump"))) return;
 
-                    isKoopa = targetHost;
-
-                    static int guardCount = 0;
-                    static bool wasGuard = false;
-                    bool startGuard = al::isActionPlaying(targetHost, "Guard1");
-                    bool isGuard = al::isActionPlaying(targetHost, "Guard5");
-
-                    if (isGuard && !wasGuard) guardCount++;
-                    wasGuard = isGuard;
-
-                    if (startGuard) {
-                        wasGuard = false;
-                        guardCount = 0;
-                        return;
-                    }
-                    if (isGuard && guardCount == 4) {
-                        isFinalPunch = true;
-                        return;
-                    }
-                    if (isGuard && guardCount >= 5) {
-                        rs::sendMsgKoopaCapPunchFinishL(target, source);
-                        guardCount = 0;
-                        return;
+                    if (BossState::Koopa* koopa = BossState::find(targetHost, true)
+                    ) {
+                        switch (BossState::updateGuard(*koopa)
+                        ) {
+                            case BossState::Guard::Reset:
+                            case BossState::Guard::FinalPunch:
+                                return;
+                            case BossState::Guard::Finish:
+                                rs::sendMsgKoopaCapPunchFinishL(target, source);
+                                return;
+                            case BossState::Guard::None:
+                                break;
+                        }
                     }
                     if (!isInHitBuffer) {
                         bool isKnockback = rs::sendMsgKoopaCapPunchKnockBackL(target, source);
                         if (isKnockback || rs::sendMsgKoopaCapPunchL(target, source)
                         ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            if (isKnockback) al::tryStartSe(thisPtr, "DamageHit");
-                            if (!al::isEffectEmitting(targetHost, "Guard")) al::tryEmitEffect(sourceHost, "KoopaHit", &spawnPos);
+                            hitBuffer.insert(targetHost);
+                            if (isKnockback) Fx::startSe(thisPtr, Fx::Se::DamageHit);
+                            if (!al::isEffectEmitting(targetHost, "Guard")) Fx::emit(sourceHost, Fx::Effect::KoopaHit, &c.getSpawnPos());
                             return;
                         }
                     }
                 }
                 if(!isInHitBuffer
                 ) {
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "BlockHard")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "BossForestBlock")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "GolemClimb")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "MarchingCubeBlock")
-                    ) {
-                        if (rs::sendMsgHammerBrosHammerHackAttack(target, source)
-                        ){
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            return;
-                        }
-                    }
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "BreakMapParts")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "BreakableWall")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "CatchBomb")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "DamageBall")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "KickStone")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "KoopaDamageBall")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "MoonBasement")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "PlayGuideBoard")
-                        || (al::isEqualSubString(typeid(*targetHost).name(), "SignBoard")
-                            && !al::isModelName(targetHost, "SignBoardNormal"))
-                        || (al::isEqualSubString(typeid(*targetHost).name(), "TreasureBox")
-                            && al::isModelName(targetHost, "TreasureBoxWood"))
-                    ) {
-                        if (al::sendMsgExplosion(target, source, nullptr)
-                            || rs::sendMsgStatueDrop(target, source)
-                            || rs::sendMsgKoopaCapPunchL(target, source)
-                            || rs::sendMsgKoopaHackPunch(target, source)
-                            || rs::sendMsgKoopaHackPunchCollide(target, source)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            al::tryEmitEffect(sourceHost, "Hit", &spawnPos);
-                            return;
-                        }
-                    }
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "BreedaWanwan")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "TRex")
-                    ) {
-                        if (al::sendMsgPlayerObjHipDropReflect(target, source, nullptr)
-                            || al::sendMsgPlayerHipDrop(target, source, nullptr)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            return;
-                        }
-                    }
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "CapSwitch")
+                    if (targetClass & ActorClass::CapSwitch
                     ) {
                         al::setNerve(targetHost, getNerveAt(0x1CE3E18));
-                        hitBuffer[hitBufferCount++] = targetHost;
-                        al::tryEmitEffect(sourceHost, "Hit", &spawnPos);
+                        hitBuffer.insert(targetHost);
+                        Fx::emit(sourceHost, Fx::Effect::Hit, &c.getSpawnPos());
                         return;
                     }
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "CapSwitchTimer")
+                    if (targetClass & ActorClass::CapSwitchTimer
                     ) {
                         al::setNerve(targetHost, getNerveAt(0x1CE4338));
                         al::invalidateClipping(targetHost);
-                        hitBuffer[hitBufferCount++] = targetHost;
-                        al::tryEmitEffect(sourceHost, "Hit", &spawnPos);
+                        hitBuffer.insert(targetHost);
+                        Fx::emit(sourceHost, Fx::Effect::Hit, &c.getSpawnPos());
                         return;
                     }
-                    if ((al::isEqualSubString(typeid(*targetHost).name(), "Car")
-                        && (al::isModelName(targetHost, "Car") || al::isModelName(targetHost, "CarBreakable"))
-                        && !al::isSensorName(target, "Brake"))
-                        || al::isEqualSubString(typeid(*targetHost).name(), "ChurchDoor")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "CollapseSandHill")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "Doshi")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "ReactionObject")
-                        || (al::isEqualSubString(typeid(*targetHost).name(), "SignBoard")
-                            && al::isModelName(targetHost, "SignBoardNormal"))
-                    ) {
-                        if (rs::sendMsgCapReflect(target, source)
-                            || rs::sendMsgCapAttack(target, source)
-                            || rs::sendMsgCapAttackCollide(target, source)
-                            || rs::sendMsgCapReflectCollide(target, source)
-                            || rs::sendMsgCapTouchWall(target, source, sead::Vector3f{0,0,0}, sead::Vector3f{0,0,0})
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            return;
-                        }
-                    }
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "YoshiFruit")
-                    ) {
-                        if (al::sendMsgPlayerObjHipDropReflect(target, source, nullptr)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            return;
-                        }
-                    }
-                    if (al::isSensorNpc(target) || al::isSensorRide(target)
-                    ) {
-                        if (al::sendMsgPlayerSpinAttack(target, source, nullptr)
-                            || rs::sendMsgCapReflect(target, source)
-                            || al::sendMsgPlayerObjHipDropReflect(target, source, nullptr)
-                            || rs::sendMsgCapAttack(target, source)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            al::tryStartSe(thisPtr, "BlowHit");
-                            return;
-                        }
-                    }
-                    if (al::isSensorEnemyBody(target)
-                    ) {
-                        if (rs::sendMsgHackAttack(target, source)
-                            || rs::sendMsgCapReflect(target, source)
-                            || rs::sendMsgCapAttack(target, source)
-                            || al::sendMsgPlayerObjHipDropReflect(target, source, nullptr)
-                            || rs::sendMsgTsukkunThrust(target, source, fireDir, 0, true)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            al::tryStartSe(thisPtr, "BlowHit");
-                            return;
-                        }
-                    }
-                    if (al::isSensorMapObj(target)
-                        && !al::isEqualSubString(typeid(*targetHost).name(), "HipDrop")
-                        && !al::isEqualSubString(typeid(*targetHost).name(), "TreasureBox")
-                    ) {
-                        bool isBlowHit = false;
-                        if (rs::sendMsgHackAttack(target, source)
-                            || al::sendMsgPlayerSpinAttack(target, source, nullptr)
-                            || rs::sendMsgCapReflect(target, source)
-                            || al::sendMsgPlayerHipDrop(target, source, nullptr)
-                            || rs::sendMsgCapAttack(target, source)
-                            || al::sendMsgPlayerObjHipDropReflect(target, source, nullptr)
-                            || (isBlowHit = rs::sendMsgByugoBlow(target, source, sead::Vector3f::zero))
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            if (!isBlowHit) al::tryStartSe(thisPtr, "BlowHit");
-                            return;
-                        }
-                    }
+
+                    if (AttackResolver::react(profile, c, thisPtr) == AttackResolver::Result::Hit) return;
                 }
             }
             Orig(thisPtr, source, target);
@@ -361,121 +211,14 @@ namespace AttackSensor {
                 return;
             }
             
-            al::LiveActor* sourceHost = al::getSensorHost(source);
-            al::LiveActor* targetHost = al::getSensorHost(target);
-            
-            if (!sourceHost || !targetHost) return;
-            if (targetHost == isHakoniwa) return;
-
-            sead::Vector3f sourcePos = al::getSensorPos(source);
-            sead::Vector3f targetPos = al::getSensorPos(target);
-            sead::Vector3f spawnPos = (sourcePos + targetPos) * 0.5f;
-            spawnPos.y += 20.0f;
-            
-            sead::Vector3 fireDir = al::getTrans(targetHost) - al::getTrans(sourceHost);
-            fireDir.normalize();
+            AttackReactions::Contact c(source, target);
+            if (!c.isValid()) return;
+            if (c.targetHost == isHakoniwa) return;
 
-            if(al::isSensorName(source, "AttackHack")
+            if(source == sensors.hammerAttack
             ) {
-                bool isInHitBuffer = false;
-                for(int i = 0; i < hitBufferCount; i++) {
-                    if(hitBuffer[i] == targetHost) {
-                        isInHitBuffer = true;
-                        break;
-                    }
-                }
-                if(!isInHitBuffer
-                ) {
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "BlockHard")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "BossForestBlock")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "BreakMapParts")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "CatchBomb")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "DamageBall")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "FrailBox")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "KoopaDamageBall")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "MarchingCubeBlock")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "MoonBasement")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "PlayGuideBoard")
-                        || (al::isEqualSubString(typeid(*targetHost).name(), "ReactionObject")
-                            && al::isSensorCollision(target))
-                        || (al::isEqualSubString(typeid(*targetHost).name(), "SignBoard")
-                            && !al::isModelName(targetHost, "SignBoardNormal"))
-                        || al::isEqualSubString(typeid(*targetHost).name(), "TreasureBox")
-                    ) {
-                        if (al::sendMsgExplosion(target, source, nullptr)
-                            || rs::sendMsgStatueDrop(target, source)
-                            || rs::sendMsgKoopaCapPunchL(target, source)
-                            || rs::sendMsgKoopaHackPunch(target, source)
-                            || rs::sendMsgKoopaHackPunchCollide(target, source)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            if (!al::isEqualSubString(typeid(*targetHost).name(), "BossForestBlock")) al::tryEmitEffect(sourceHost, "HammerHit", &spawnPos);
-                            return;
-                        }
-                    }
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "Car")
-                        && (al::isModelName(targetHost, "Car") || al::isModelName(targetHost, "CarBreakable"))
-                        && !al::isSensorName(target,"Brake")
-                    ) {
-                        if (rs::sendMsgPlayerTouchFloorJumpCode(target, source)
-                            || al::sendMsgExplosion(target, source, nullptr)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            al::tryEmitEffect(sourceHost, "HammerHit", &spawnPos);
-                            return;
-                        }
-                    }
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "CollapseSandHill")
-                        || al::isEqualSubString(typeid(*targetHost).name(), "Doshi")
-                        || (al::isEqualSubString(typeid(*targetHost).name(), "SignBoard")
-                            && al::isModelName(targetHost, "SignBoardNormal"))
-                    ) {
-                        if (rs::sendMsgCapAttack(target, source)
-                            || rs::sendMsgCapAttackCollide(target, source)
-                            || rs::sendMsgCapReflectCollide(target, source)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            return;
-                        }
-                    }
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "Koopa")
-                        && al::isModelName(targetHost, "KoopaBig")
-                    ) {
-                        if (rs::sendMsgKoopaCapPunchFinishL(target, source)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            al::tryEmitEffect(sourceHost, "KoopaFinishHit", &spawnPos);
-                            return;
-                        }
-                    }
-                    if (al::isEqualSubString(typeid(*targetHost).name(), "TRex")
-                    ) {
-                        if (al::sendMsgPlayerHipDrop(target, source, nullptr)
-                            || rs::sendMsgSeedAttackBig(target, source)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            al::tryEmitEffect(sourceHost, "HammerHit", &spawnPos);
-                            return;
-                        }
-                    }
-                    if (rs::sendMsgTRexAttack(target, source)
-                        || al::sendMsgPlayerHipDrop(target, source, nullptr)
-                        || al::sendMsgPlayerObjHipDrop(target, source, nullptr)
-                        || al::sendMsgPlayerObjHipDropReflect(target, source, nullptr)
-                        || rs::sendMsgPlayerHipDropHipDropSwitch(target, source)
-                        || rs::sendMsgHackAttack(target, source)
-                        || rs::sendMsgSphinxRideAttackTouchThrough(target, source, fireDir, fireDir)
-                        || rs::sendMsgCapReflect(target, source)
-                        || (!al::isEqualSubString(typeid(*targetHost).name(),"Souvenir")
-                            && rs::sendMsgCapAttack(target, source))
-                        || (!al::isEqualSubString(typeid(*targetHost).name(),"ReactionObject")
-                            && rs::sendMsgTsukkunThrust(target, source, fireDir, 0, true))
-                        || al::sendMsgExplosion(target, source, nullptr)
-                    ) {
-                        hitBuffer[hitBufferCount++] = targetHost;
-                        return;
-                    }
-                }
+                c.classify();
+                if (AttackResolver::attack(AttackResolver::Hammer, c, isHakoniwa) == AttackResolver::Result::Hit) return;
             }
             Orig(thisPtr, source, target);
         }
@@ -492,96 +235,15 @@ namespace AttackSensor {
             if (!isFireball && !isIceball) return;
             if (isIceball && al::isSensorName(target, "Wick")) return;
 
-            al::LiveActor* sourceHost = al::getSensorHost(source);
-            al::LiveActor* targetHost = al::getSensorHost(target);
-
-            if (!sourceHost || !targetHost) return;
-            if (targetHost == isHakoniwa) return;
-
-            const char* targetName = targetHost->getName();
-            bool targetIceball = al::isEqualString(targetName, "MarioIceBall");
-
-            if (targetIceball) return;
-
-            sead::Vector3f sourcePos = al::getSensorPos(source);
-            sead::Vector3f targetPos = al::getSensorPos(target);
-            sead::Vector3f spawnPos = (sourcePos + targetPos) * 0.5f;
-            spawnPos.y += 20.0f;
+            AttackReactions::Contact c(source, target);
+            if (!c.isValid()) return;
+            if (c.targetHost == isHakoniwa) return;
+            if (al::isEqualString(c.targetHost->getName(), "MarioIceBall")) return;
 
             if(al::isSensorName(source, "AttackHack")
             ) {
-                // Handle ice cubes
-                if (al::isEqualSubString(typeid(*targetHost).name(), "PlayerIceCube")) { ((PlayerIceCube*)targetHost)->markHit(); return; }
-
-                bool isInHitBuffer = false;
-                for(int i = 0; i < hitBufferCount; i++) {
-                    if(hitBuffer[i] == targetHost) {
-                        isInHitBuffer = true;
-                        break;
-                    }
-                }
-                if(!isInHitBuffer
-                ) {
-                    if (isIceball) {
-                        if (al::isSensorEnemyBody(target)
-                        ) {
-                            if (PlayerFreeze::isFrozen(targetHost)
-                            ) {
-                                if (al::sendMsgPlayerFireBallAttack(target, source)
-                                    || rs::sendMsgHackAttack(target, source)
-                                    || al::sendMsgExplosion(target, source, nullptr)
-                                ) {
-                                    hitBuffer[hitBufferCount++] = targetHost;
-                                    PlayerFreeze::unfreezeActor(targetHost);
-                                    if (!al::isEffectEmitting(sourceHost, "Hit")) al::tryEmitEffect(isHakoniwa, "Hit", &spawnPos);
-                                    al::tryEmitEffect(sourceHost, "IceHit", &targetPos);
-                                    al::tryEmitEffect(sourceHost, "Disappear", &sourcePos);
-                                    thisPtr->kill();
-                                    return;
-                                }
-                            } else {
-                                hitBuffer[hitBufferCount++] = targetHost;
-                                PlayerFreeze::freezeActor(targetHost, 1800);
-                                al::tryEmitEffect(sourceHost, "IceHit", &targetPos);
-                                al::tryEmitEffect(sourceHost, "Disappear", &sourcePos);
-                                thisPtr->kill();
-                                return;
-                            }
-                        }
-                        else {
-                            if (al::sendMsgPlayerFireBallAttack(target, source)
-                                || rs::sendMsgFireBrosFireBallCollide(target, source)
-                                || rs::sendMsgWeaponItemGet(target, source)
-                                || rs::sendMsgByugoBlow(target, source, sead::Vector3f::zero)
-                            ) {
-                                hitBuffer[hitBufferCount++] = targetHost;
-                                al::tryEmitEffect(sourceHost, "IceHit", &targetPos);
-                                al::tryEmitEffect(sourceHost, "Disappear", &sourcePos);
-                                thisPtr->kill();
-                                return;
-                            }
-                            else if (rs::sendMsgHackAttack(target, source)
-                                || al::sendMsgExplosion(target, source, nullptr)
-                            ) {
-                                hitBuffer[hitBufferCount++] = targetHost;
-                                if (!al::isEffectEmitting(sourceHost, "Hit")) al::tryEmitEffect(isHakoniwa, "Hit", &spawnPos);
-                                al::tryEmitEffect(sourceHost, "IceHit", &targetPos);
-                                al::tryEmitEffect(sourceHost, "Disappear", &sourcePos);
-                                thisPtr->kill();
-                                return;
-                            }
-                        }
-                    }
-                    if (isFireball) {
-                        if (rs::sendMsgHackAttack(target, source)
-                            || al::sendMsgExplosion(target, source, nullptr)
-                        ) {
-                            hitBuffer[hitBufferCount++] = targetHost;
-                            if (!al::isEffectEmitting(sourceHost, "Hit")) al::tryEmitEffect(isHakoniwa, "Hit", &spawnPos);
-                            return;
-                        }
-                    }
-                }
+                c.classify();
+                AttackResolver::attack(isIceball ? AttackResolver::Iceball : AttackResolver::Fireball, c, isHakoniwa);
             }
         }
     };
@@ -0,0 +1,101 @@
+#pragma once
+#include "custom/_Globals.h"
+
+namespace BossState {
+
+    // Guard and final punch progress for one Koopa. An entry lives until
+    // its actor dies or the stage is reloaded.
+    struct Koopa {
+        al::LiveActor* actor = nullptr;
+        s32 guardCount = 0;
+        bool isGuard = false;       // Guard5 was playing on the last contact
+        bool isFinalPunch = false;  // next punch starts the finisher
+    };
+
+    inline constexpr s32 KOOPA_MAX = 4;
+    inline Koopa koopas[KOOPA_MAX] = {};
+    inline s32 koopaCount = 0;
+    inline s32 finalPunchCount = 0;
+
+    inline void setFinalPunch(Koopa& koopa, bool isFinalPunch) {
+        if (koopa.isFinalPunch == isFinalPunch) return;
+        koopa.isFinalPunch = isFinalPunch;
+        finalPunchCount += isFinalPunch ? 1 : -1;
+    }
+
+    inline void release(Koopa& koopa) {
+        if (!koopa.actor) return;
+        setFinalPunch(koopa, false);
+        koopa = {};
+        koopaCount--;
+    }
+
+    // Actors from the previous stage are gone, so nothing carries over
+    inline void clear() {
+        for (Koopa& koopa : koopas) koopa = {};
+        koopaCount = 0;
+        finalPunchCount = 0;
+    }
+
+    inline Koopa* find(al::LiveActor* actor, bool isCreate) {
+        Koopa* free = nullptr;
+        for (Koopa& koopa : koopas) {
+            if (koopa.actor == actor) return &koopa;
+            if (!koopa.actor && !free) free = &koopa;
+        }
+        if (!isCreate || !free) return nullptr;
+
+        free->actor = actor;
+        koopaCount++;
+        return free;
+    }
+
+    enum class Guard : u8 {
+        None,        // no guard outcome, punch normally
+        Reset,       // guard sequence (re)started
+        FinalPunch,  // fourth guard, next punch is the finisher
+        Finish,      // finisher landed
+    };
+
+    // Counts Guard5 rising edges per contact
+    inline Guard updateGuard(Koopa& koopa) {
+        bool isStartGuard = al::isActionPlaying(koopa.actor, "Guard1");
+        bool isGuard = al::isActionPlaying(koopa.actor, "Guard5");
+
+        if (isGuard && !koopa.isGuard) koopa.guardCount++;
+        koopa.isGuard = isGuard;
+
+        if (isStartGuard) {
+            koopa.isGuard = false;
+            koopa.guardCount = 0;
+            return Guard::Reset;
+        }
+        if (isGuard && koopa.guardCount == 4) {
+            setFinalPunch(koopa, true);
+            return Guard::FinalPunch;
+        }
+        if (isGuard && koopa.guardCount >= 5) {
+            koopa.guardCount = 0;
+            return Guard::Finish;
+        }
+        return Guard::None;
+    }
+
+    // Used when the punch animation is picked
+    inline bool consumeFinalPunch() {
+        if (!finalPunchCount) return false;
+        for (Koopa& koopa : koopas) setFinalPunch(koopa, false);
+        return true;
+    }
+
+    // Drops dead Koopas, and pending finishers once the player walks away
+    inline void update(const al::LiveActor* player) {
+        if (!koopaCount) return;
+
+        for (Koopa& koopa : koopas) {
+            if (!koopa.actor) continue;
+            if (al::isDead(koopa.actor)) { release(koopa); continue; }
+            if (koopa.isFinalPunch && !al::isNear(player, koopa.actor, 500.0f)) setFinalPunch(koopa, false);
+        }
+    }
+}
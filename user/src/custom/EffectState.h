@@ -0,0 +1,79 @@
+#pragma once
+#include "custom/_Globals.h"
+
+namespace EffectState {
+
+    // Looping effects on the player model that hooks keep on or off.
+    // Hooks set the state they want each frame and update() only reaches
+    // the effect keeper when a state flips.
+    enum Id : u8 {
+        DashSuper,
+        DashSuperGlide,
+        Bonfire,
+        BonfireSuper,
+        IdNum,
+    };
+
+    inline constexpr const char* names[IdNum] = { "DashSuper", "DashSuperGlide", "Bonfire", "BonfireSuper" };
+
+    // Effects can be cleared behind our back (hacks, demos), so every
+    // state is reissued once in a while
+    inline constexpr s32 RESYNC_FRAMES = 60;
+
+    struct Stats {
+        u32 frames = 0;
+        u32 requests = 0;  // set() calls, one per former emit/delete
+        u32 emits = 0;
+        u32 deletes = 0;
+    };
+
+    inline u32 desired = 0;
+    inline u32 active = 0;
+    inline u32 touched = 0;  // effects some hook has set, the only ones update() touches
+    inline bool isSynced = false;
+    inline s32 resyncTimer = 0;
+    inline Stats stats = {};
+
+    inline void set(Id id, bool isOn) {
+        stats.requests++;
+        touched |= 1u << id;
+        if (isOn) desired |= 1u << id;
+        else desired &= ~(1u << id);
+    }
+
+    // Forget what the keeper holds, e.g. for a new player model
+    inline void clear() {
+        desired = 0;
+        active = 0;
+        touched = 0;
+        isSynced = false;
+    }
+
+    inline void update(al::LiveActor* model) {
+        if (!model) return;
+        stats.frames++;
+
+        if (--resyncTimer <= 0) { isSynced = false; resyncTimer = RESYNC_FRAMES; }
+
+        const u32 changed = (isSynced ? desired ^ active : ~0u) & touched;
+        if (!changed) return;
+
+        for (s32 id = 0; id < IdNum; id++) {
+            const u32 bit = 1u << id;
+            if (!(changed & bit)) continue;
+
+            if (desired & bit) { al::tryEmitEffect(model, names[id], nullptr); stats.emits++; }
+            else { al::tryDeleteEffect(model, names[id]); stats.deletes++; }
+        }
+        active = desired;
+        isSynced = true;
+    }
+
+    inline void logStats() {
+        if (!stats.frames) return;
+
+        const u32 issued = stats.emits + stats.deletes;
+        logLine("Effect state: %u frames, %u emits, %u deletes, %u of %u calls avoided",
+            stats.frames, stats.emits, stats.deletes, stats.requests > issued ? stats.requests - issued : 0, stats.requests);
+    }
+}
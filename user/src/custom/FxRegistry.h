@@ -0,0 +1,53 @@
+#pragma once
+#include "custom/_Globals.h"
+
+namespace Fx {
+
+    // Effects and sounds the mod starts by name, as compact ids
+    enum class Effect : u8 {
+        None,
+        Hit,
+        KoopaHit,
+        KoopaFinishHit,
+        HammerHit,
+        HammerLandHit,
+        IceHit,
+        Disappear,
+        AppearBloom,
+        Accel,
+        AccelSecond,
+        Num,
+    };
+
+    enum class Se : u8 {
+        None,
+        BlowHit,
+        DamageHit,
+        FireBallShoot,
+        Bloom,
+        HammerLand,
+        HammerHit,
+        Accel,
+        AccelSecond,
+        Num,
+    };
+
+    inline constexpr const char* effectNames[(u8)Effect::Num] = {
+        nullptr, "Hit", "KoopaHit", "KoopaFinishHit", "HammerHit", "HammerLandHit", "IceHit", "Disappear",
+        "AppearBloom", "Accel", "AccelSecond",
+    };
+
+    inline constexpr const char* seNames[(u8)Se::Num] = {
+        nullptr, "BlowHit", "DamageHit", "FireBallShoot", "Bloom", "HammerLand", "HammerHit", "Accel", "AccelSecond",
+    };
+
+    // Plain by-name calls; the keepers offer no handle lookup in the
+    // headers the mod builds against, so nothing is resolved up front.
+    inline bool emit(al::LiveActor* actor, Effect id, const sead::Vector3f* pos = nullptr) {
+        return al::tryEmitEffect(actor, effectNames[(u8)id], pos);
+    }
+
+    inline bool startSe(al::LiveActor* actor, Se id) {
+        return al::tryStartSe(actor, seNames[(u8)id]);
+    }
+}
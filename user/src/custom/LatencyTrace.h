@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdio>
+#include <exl/nx/kernel/svc.h>
+#include "ModConfig.h"
+#include "custom/_Globals.h"
+#include "custom/PadInput.h"
+#include "headers/LatencyTracer.h"
+
+namespace LatencyTrace {
+
+    // Input latency of the spin and the fireball, measured in game frames
+    // and in system ticks. Compiled out unless ALLOW_LATENCY_TRACE is set.
+    using Channel = LatencyTracer::Channel;
+    using Stage = LatencyTracer::Stage;
+
+    inline constexpr u64 TICK_FREQUENCY = 19200000;  // system tick rate in Hz
+
+    inline constexpr const char* channelNames[LatencyTracer::ChannelNum] = { "Spin", "Fireball" };
+    inline constexpr const char* stageNames[LatencyTracer::StageNum] = { "Accept", "Appear", "FirstStep", "Hitbox", "Shoot" };
+
+    inline LatencyTracer tracer;
+
+    inline void tag(Channel channel, Stage stage) {
+        #ifdef ALLOW_LATENCY_TRACE
+            tracer.tag(channel, stage, svcGetSystemTick());
+        #endif
+    }
+
+    inline void end(Channel channel, Stage stage) {
+        #ifdef ALLOW_LATENCY_TRACE
+            tracer.end(channel, stage, svcGetSystemTick());
+        #endif
+    }
+
+    inline bool hasReached(Channel channel, Stage stage) {
+        #ifdef ALLOW_LATENCY_TRACE
+            return tracer.hasReached(channel, stage);
+        #else
+            return false;
+        #endif
+    }
+
+    inline void dump() {
+        for (s32 c = 0; c < LatencyTracer::ChannelNum; c++) {
+            for (s32 s = 0; s < LatencyTracer::StageNum; s++) {
+                const LatencyTracer::Histogram& hist = tracer.getHistogram((Channel)c, (Stage)s);
+                if (!hist.count) continue;
+
+                // Frames:count for every non-empty bucket
+                char buckets[128] = {};
+                s32 len = 0;
+                for (s32 i = 0; i < LatencyTracer::BUCKET_NUM && len < (s32)sizeof(buckets); i++) {
+                    if (!hist.buckets[i]) continue;
+                    len += snprintf(buckets + len, sizeof(buckets) - len, " %d%s:%u",
+                        i, i == LatencyTracer::BUCKET_NUM - 1 ? "+" : "", hist.buckets[i]);
+                }
+
+                logLine("Latency %s>%s: %u, avg %.2f frames / %.2f ms, max %.2f ms |%s",
+                    channelNames[c], stageNames[s], hist.count,
+                    (f32)hist.frameSum / hist.count,
+                    (f32)(hist.tickSum / hist.count) * 1000.0f / TICK_FREQUENCY,
+                    (f32)hist.tickMax * 1000.0f / TICK_FREQUENCY, buckets);
+            }
+        }
+        logLine("Latency: %u traces dropped by a new press", tracer.getDropped());
+    }
+
+    // Once per frame, right after pad::capture
+    inline void update() {
+        #ifdef ALLOW_LATENCY_TRACE
+            const u64 tick = svcGetSystemTick();
+            tracer.beginFrame();
+
+            if (pad::trigger<pad::Button::Spin>()) tracer.press(LatencyTracer::Spin, tick);
+            if ((isFire || isIce) && pad::trigger<pad::Button::R>()) tracer.press(LatencyTracer::Fireball, tick);
+
+            const u16 dumpHold = pad::Button::ZL | pad::Button::ZR;
+            if ((pad::getHold(-1) & dumpHold) == dumpHold && pad::trigger<pad::Button::Down>()) dump();
+        #endif
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <exl/nx/kernel/svc.h>
+#include "custom/_Globals.h"
+#include "headers/PadBuffer.h"
+
+namespace pad {
+
+    // Buttons read once per frame. Hooks ask the snapshot instead of the
+    // controller library, and GalaxySpin is asked for as Button::Spin.
+    using Button = PadSnapshot::Button;
+
+    inline PadSnapshot snapshot;
+    inline PadBuffer buffer;
+    inline s32 bufferFrames = 1;
+
+    // Triggers and releases of a capture older than two 60 Hz frames are
+    // dropped, so hooks that run while the player doesn't move (scene
+    // changes, cutscenes) don't see one press over and over.
+    inline constexpr u64 STALE_TICKS = 19200000 / 30;
+    inline u64 captureTick = 0;
+    inline bool isExpired = true;
+
+    // Top of the player's frame, before any hook asks
+    inline void capture() {
+        const ModOptions* options = mallow::config::getConfg<ModOptions>();
+        snapshot.capture(options->spinButtonMask);
+        buffer.update(snapshot);
+        bufferFrames = options->inputBuffer;
+        captureTick = svcGetSystemTick();
+        isExpired = false;
+    }
+
+    inline void clear() {
+        buffer.clear();
+        snapshot.expire();
+        isExpired = true;
+    }
+
+    inline void expireStale() {
+        if (isExpired || svcGetSystemTick() - captureTick <= STALE_TICKS) return;
+        snapshot.expire();
+        isExpired = true;
+    }
+
+    inline u16 getTrigger(s32 port) {
+        expireStale();
+        if (port != -1) snapshot.use(port);
+        return snapshot.getTrigger(port);
+    }
+
+    inline u16 getHold(s32 port) {
+        if (port != -1) snapshot.use(port);
+        return snapshot.getHold(port);
+    }
+
+    inline u16 getRelease(s32 port) {
+        expireStale();
+        if (port != -1) snapshot.use(port);
+        return snapshot.getRelease(port);
+    }
+
+    template <u16 Buttons> inline bool trigger(s32 port = -1) { return getTrigger(port) & Buttons; }
+    template <u16 Buttons> inline bool hold(s32 port = -1) { return getHold(port) & Buttons; }
+    template <u16 Buttons> inline bool release(s32 port = -1) { return getRelease(port) & Buttons; }
+
+    // Pressed within the configured input buffer and not consumed yet
+    template <u16 Buttons> inline bool buffered(s32 port = -1) {
+        if (port != -1) snapshot.use(port);
+        return buffer.isTriggered(port, Buttons, bufferFrames);
+    }
+
+    template <u16 Buttons> inline void consume(s32 port = -1) { buffer.consume(port, Buttons, bufferFrames); }
+
+    // Button the config picked for GalaxySpin
+    inline u16 getSpinButton() { return snapshot.getSpinButton(); }
+}
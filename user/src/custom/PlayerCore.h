@@ -2,11 +2,43 @@
 #include "ModConfig.h"
 #include "custom/_Globals.h"
 #include "custom/_Nerves.h"
+#include "custom/ActorClass.h"
+#include "custom/AnimRemap.h"
+#include "custom/AnimTraits.h"
+#include "custom/EffectState.h"
+#include "custom/FxRegistry.h"
+#include "custom/LatencyTrace.h"
+#include "custom/PadInput.h"
+#include "custom/PlayerFrameContext.h"
+#include "custom/AttackResolver.h"
 #include "custom/PowerUps.h"
 #include "custom/PlayerFreeze.h"
+#include "custom/Replay.h"
 
 namespace PlayerCore {
 
+    // Suits other than Feather need the matching cap
+    inline SuitKind resolveSuitKind(const char* costume, const char* cap) {
+        static constexpr struct { const char* name; SuitKind kind; } suits[] = {
+            #ifdef ALLOW_MARIO
+                { "Mario", SuitKind::Mario },
+            #endif
+            { "MarioColorFire",  SuitKind::Fire },
+            { "MarioColorIce",   SuitKind::Ice },
+            { "MarioTanooki",    SuitKind::Tanooki },
+            { "MarioColorBrawl", SuitKind::Brawl },
+            { "MarioColorSuper", SuitKind::Super },
+        };
+
+        if (!costume) return SuitKind::Other;
+        if (al::isEqualString(costume, "MarioFeather")) return SuitKind::Feather;
+        if (!cap) return SuitKind::Other;
+
+        for (const auto& suit : suits)
+            if (al::isEqualString(costume, suit.name) && al::isEqualString(cap, suit.name)) return suit.kind;
+        return SuitKind::Other;
+    }
+
     struct PlayerActorHakoniwaInitPlayer : public mallow::hook::Trampoline<PlayerActorHakoniwaInitPlayer> {
         static void Callback(PlayerActorHakoniwa* thisPtr, const al::ActorInitInfo* actorInfo, const PlayerInitInfo* playerInfo) {
             Orig(thisPtr, actorInfo, playerInfo);
@@ -14,29 +46,52 @@ namespace PlayerCore {
             // Set Hakoniwa pointer
             isHakoniwa = thisPtr;
 
+            // Dump attack stats gathered so far
+            ActorClass::logCacheStats();
+            AttackResolver::logStats();
+            EffectState::logStats();
+
             PowerUps::executeInitPlayer(thisPtr, actorInfo, playerInfo);
 
+            BossState::clear();
+            AttackReactions::clearMemo();
+            EffectState::clear();
+            spinCtrl.clear();
+            pad::clear();
+            PlayerFreeze::clear();
+            Replay::onStageLoad();
+
+            // Resolve sensors and model parts once, after the hammer exists
+            sensors.init(thisPtr, isHammer);
+            playerParts.init(thisPtr->mModelHolder->findModelActor("Normal"));
+            frameCtx.begin(thisPtr);
+
             // Check for Super suit costume and cap
             const char* costume = GameDataFunction::getCurrentCostumeTypeName(thisPtr);
             const char* cap = GameDataFunction::getCurrentCapTypeName(thisPtr);
 
-            #ifdef ALLOW_MARIO
-                isMario = (costume && al::isEqualString(costume, "Mario"))
-                    && (cap && al::isEqualString(cap, "Mario"));
-            #endif
-
             isNoCap = (cap && al::isEqualString(cap, "MarioNoCap"));
-            isFeather = (costume && al::isEqualString(costume, "MarioFeather"));
-            isFire = (costume && al::isEqualString(costume, "MarioColorFire"))
-                && (cap && al::isEqualString(cap, "MarioColorFire"));
-            isIce = (costume && al::isEqualString(costume, "MarioColorIce"))
-                && (cap && al::isEqualString(cap, "MarioColorIce"));
-            isTanooki = (costume && al::isEqualString(costume, "MarioTanooki"))
-                && (cap && al::isEqualString(cap, "MarioTanooki"));
-            isBrawl = (costume && al::isEqualString(costume, "MarioColorBrawl"))
-                && (cap && al::isEqualString(cap, "MarioColorBrawl"));
-            isSuper = (costume && al::isEqualString(costume, "MarioColorSuper"))
-                && (cap && al::isEqualString(cap, "MarioColorSuper"));
+            suitKind = resolveSuitKind(costume, cap);
+
+            // Flags for code that isn't specialized per suit
+            isMario = suitKind == SuitKind::Mario;
+            isFeather = suitKind == SuitKind::Feather;
+            isFire = suitKind == SuitKind::Fire;
+            isIce = suitKind == SuitKind::Ice;
+            isTanooki = suitKind == SuitKind::Tanooki;
+            isBrawl = suitKind == SuitKind::Brawl;
+            isSuper = suitKind == SuitKind::Super;
+
+            suitMoveAnim = getSuitMoveAnim(suitKind);
+            suitWearEndAnim = getSuitWearEndAnim(suitKind);
+            PowerUps::selectSuit(suitKind);
+
+            // Start from the loaded PlayerConst, then layer the suit on top
+            constOverride.init(thisPtr->mConst);
+            if (isSuper) constOverride.set(PlayerConstOverride::Suit, moonMarioConst);
+
+            // Suit animation variants are swapped in at startAnim
+            AnimRemap::init();
         }
     };
 
@@ -68,41 +123,44 @@ namespace PlayerCore {
 
     struct PlayerMovementHook : public mallow::hook::Trampoline<PlayerMovementHook> {
         static void Callback(PlayerActorHakoniwa* thisPtr) {
+            const Replay::FrameScope replayFrame(thisPtr);
+            frameCtx.begin(thisPtr);
+            pad::capture();
+            LatencyTrace::update();
+            Replay::update();
+            PlayerFreeze::tick();
+
             Orig(thisPtr);
+            frameCtx.invalidatePhysics();
+            auto& ctx = frameCtx.of(thisPtr);
 
             auto* anim   = thisPtr->mAnimator;
-            auto* holder = thisPtr->mModelHolder;
-            auto* model  = holder->findModelActor("Normal");
-            auto* cape = al::tryGetSubActor(model, "ケープ");
-            al::LiveActor* face = al::tryGetSubActor(model, "顔");
+            auto* model  = playerParts.model;
+            auto* face = playerParts.face;
 
             PowerUps::executeMovement(thisPtr);
 
-            al::HitSensor* sensorSpin = al::getHitSensor(thisPtr, "GalaxySpin");
-            al::HitSensor* sensorDoubleSpin = al::getHitSensor(thisPtr, "DoubleSpin");
-            al::HitSensor* sensorPunch = al::getHitSensor(thisPtr, "Punch");
-            al::HitSensor* sensorHipDrop = al::getHitSensor(thisPtr, "HipDropKnockDown");
-
-            if (sensorSpin && sensorSpin->mIsValid)
-                thisPtr->attackSensor(sensorSpin, rs::tryGetCollidedWallSensor(thisPtr->mCollider));
+            if (PlayerSensors::isValid(sensors.galaxySpin))
+                thisPtr->attackSensor(sensors.galaxySpin, rs::tryGetCollidedWallSensor(thisPtr->mCollider));
             
-            if (sensorDoubleSpin && sensorDoubleSpin->mIsValid)
-                thisPtr->attackSensor(sensorDoubleSpin, rs::tryGetCollidedWallSensor(thisPtr->mCollider));
+            if (PlayerSensors::isValid(sensors.doubleSpin))
+                thisPtr->attackSensor(sensors.doubleSpin, rs::tryGetCollidedWallSensor(thisPtr->mCollider));
 
-            if (sensorPunch && sensorPunch->mIsValid)
-                thisPtr->attackSensor(sensorPunch, rs::tryGetCollidedWallSensor(thisPtr->mCollider));
+            if (PlayerSensors::isValid(sensors.punch))
+                thisPtr->attackSensor(sensors.punch, rs::tryGetCollidedWallSensor(thisPtr->mCollider));
 
-            if (sensorHipDrop && sensorHipDrop->mIsValid)
-                thisPtr->attackSensor(sensorHipDrop, rs::tryGetCollidedGroundSensor(thisPtr->mCollider));
+            if (PlayerSensors::isValid(sensors.hipDrop))
+                thisPtr->attackSensor(sensors.hipDrop, rs::tryGetCollidedGroundSensor(thisPtr->mCollider));
+
+            // Spin input reached its first active hitbox
+            if (LatencyTrace::hasReached(LatencyTracer::Spin, LatencyTracer::Accept)
+                && (PlayerSensors::isValid(sensors.galaxySpin) || PlayerSensors::isValid(sensors.doubleSpin)
+                    || PlayerSensors::isValid(sensors.punch)))
+                LatencyTrace::end(LatencyTracer::Spin, LatencyTracer::Hitbox);
             
-            if(galaxySensorRemaining > 0) {
-                galaxySensorRemaining--;
-                if(galaxySensorRemaining == 0) {
-                    al::invalidateHitSensor(thisPtr, "GalaxySpin");
-                    al::invalidateHitSensor(thisPtr, "DoubleSpin");
-                    isGalaxySpin = false;
-                    galaxySensorRemaining = -1;
-                }
+            if (spinCtrl.tick()) {
+                PlayerSensors::invalidate(sensors.galaxySpin);
+                PlayerSensors::invalidate(sensors.doubleSpin);
             }
 
             // Reset proximity flag
@@ -111,21 +169,23 @@ namespace PlayerCore {
             isNearSwoonedEnemy = false;
 
             // Handle Mario's Carry sensor
-            al::HitSensor* carrySensor = al::getHitSensor(thisPtr, "Carry");
-            if (carrySensor && carrySensor->mIsValid) {
+            al::HitSensor* carrySensor = sensors.carry;
+            if (PlayerSensors::isValid(carrySensor)) {
                 // Check all sensors colliding with Carry sensor
                 for (int i = 0; i < carrySensor->mSensorCount; i++) {
                     al::HitSensor* other = carrySensor->mSensors[i];
                     al::LiveActor* actor = al::getSensorHost(other);
                     
                     if (actor) {
-                        if (al::isEqualSubString(typeid(*actor).name(), "Radish")
-                            || al::isEqualSubString(typeid(*actor).name(), "Stake")
-                            || al::isEqualSubString(typeid(*actor).name(), "BossRaidRivet")
+                        const u64 actorClass = ActorClass::classify(actor);
+
+                        if (actorClass & (ActorClass::Radish
+                                | ActorClass::Stake
+                                | ActorClass::BossRaidRivet)
                         ) {
                             isNearCollectible = true;
                             break;
-                        } else if (al::isEqualSubString(typeid(*actor).name(), "TreasureBox")
+                        } else if ((actorClass & ActorClass::TreasureBox)
                             && !al::isModelName(actor, "TreasureBoxWood")
                         ) {
                             isNearTreasure = true;
@@ -144,64 +204,37 @@ namespace PlayerCore {
             }
 
             // Handle Koopa punch logic
-            if (isKoopa && !al::isNear(thisPtr, isKoopa, 500.0f)) isFinalPunch = false;
+            BossState::update(thisPtr);
 
             // Add attack to moves
             static bool wasAttackMove = false;
-            const bool isAttackMove = thisPtr->mAnimator
-                && (al::isEqualString(thisPtr->mAnimator->mCurAnim, "HipDrop")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "HipDropPunch")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "HipDropReaction")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "HipDropPunchReaction")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinJumpDownFallL")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SpinJumpDownFallR")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SwimHipDrop")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SwimHipDropPunch")
-                    || al::isEqualString(thisPtr->mAnimator->mCurAnim, "SwimDive"));
-
-            if (isAttackMove && !wasAttackMove) { al::validateHitSensor(thisPtr, "HipDropKnockDown"); hitBufferCount = 0;}
-            else if (!isAttackMove && wasAttackMove) al::invalidateHitSensor(thisPtr, "HipDropKnockDown");
+            const bool isAttackMove = AnimTraits::is(thisPtr->mAnimator, AnimTraits::HipDrop);
+
+            if (isAttackMove && !wasAttackMove) { PlayerSensors::validate(sensors.hipDrop); hitBuffer.reset(); }
+            else if (!isAttackMove && wasAttackMove) PlayerSensors::invalidate(sensors.hipDrop);
 
             wasAttackMove = isAttackMove;
 
             // Change animations
             if ((isBrawl || isSuper)
-                && face && !al::isActionPlayingSubActor(model, "顔", "WaitAngry")) al::startActionSubActor(model, "顔", "WaitAngry");
-
-            if (isBrawl && anim && anim->isAnim("WearEnd") && !anim->isAnim("WearEndBrawl")) anim->startAnim("WearEndBrawl");
-            if (isSuper && anim && anim->isAnim("WearEnd") && !anim->isAnim("WearEndSuper")) anim->startAnim("WearEndSuper");
-
-            if ((isMario && cape && al::isAlive(cape)) || isFeather || isBrawl || isSuper
-            ) {
-                if (anim && anim->isAnim("HipDropStart") && !anim->isAnim("HipDropPunchStart")) anim->startAnim("HipDropPunchStart");
-                if (anim && anim->isAnim("HipDrop") && !anim->isAnim("HipDropPunch")) anim->startAnim("HipDropPunch");
-                if (anim && anim->isAnim("HipDropLand") && !anim->isAnim("HipDropPunchLand")) anim->startAnim("HipDropPunchLand");
-                if (anim && anim->isAnim("HipDropReaction") && !anim->isAnim("HipDropPunchReaction")) anim->startAnim("HipDropPunchReaction");
-
-                if (anim && anim->isAnim("SwimHipDropStart") && !anim->isAnim("SwimHipDropPunchStart")) anim->startAnim("SwimHipDropPunchStart");
-                if (anim && (anim->isAnim("SwimHipDrop") || anim->isAnim("SwimDive")) && !anim->isAnim("SwimHipDropPunch")) anim->startAnim("SwimHipDropPunch");
-                if (anim && anim->isAnim("SwimHipDropLand") && !anim->isAnim("SwimHipDropPunchLand")) anim->startAnim("SwimHipDropPunchLand");
-
-                if (anim && anim->isAnim("LandStiffen") && !anim->isAnim("LandSuper")) anim->startAnim("LandSuper");
-                if (anim && anim->isAnim("MofumofuDemoOpening2") && !anim->isAnim("MofumofuDemoOpening2Super")) anim->startAnim("MofumofuDemoOpening2Super");
-            }
+                && face && !al::isActionPlaying(face, "WaitAngry")) al::startAction(face, "WaitAngry");
 
             #ifdef ALLOW_TAUNT // Handle Taunt actions
-                if (!thisPtr->mInput->isMove()
+                if (!ctx.isMove()
                     && (al::isNerve(thisPtr, getNerveAt(nrvHakoniwaWait))
                     || al::isNerve(thisPtr, getNerveAt(nrvHakoniwaSquat)))
                     && !al::isNerve(thisPtr, &TauntLeftNrv)
                     && !al::isNerve(thisPtr, &TauntRightNrv)
                     && !isFireThrowing()
                 ) {
-                    if (al::isPadTriggerLeft(-1)
+                    if (pad::trigger<pad::Button::Left>()
                     ) {
                         al::setNerve(thisPtr, &TauntLeftNrv);
                         return;
                     }
-                    if (al::isPadTriggerRight(-1)
+                    if (pad::trigger<pad::Button::Right>()
                     ) {
-                        tauntRightAlt = al::isPadHoldZR(-1) || al::isPadTriggerZR(-1) || al::isPadHoldZL(-1) || al::isPadTriggerZL(-1);
+                        tauntRightAlt = pad::hold<pad::Button::ZL | pad::Button::ZR>() || pad::trigger<pad::Button::ZL | pad::Button::ZR>();
                         al::setNerve(thisPtr, &TauntRightNrv);
                         return;
                     }
@@ -217,8 +250,10 @@ namespace PlayerCore {
                     }
                 }
                 if (!al::isNerve(thisPtr, &TauntLeftNrv)
-                    && !al::isNerve(thisPtr, &TauntRightNrv)) al::tryDeleteEffect(model, "BonfireSuper");
+                    && !al::isNerve(thisPtr, &TauntRightNrv)) EffectState::set(EffectState::BonfireSuper, false);
             #endif
+
+            EffectState::update(model);
         }
     };
 
@@ -233,17 +268,7 @@ namespace PlayerCore {
                     if (source && target) al::sendMsgPush(source, target);
                     return true;
                 }
-                auto* anim = thisPtr->mAnimator;
-                if (anim && (al::isEqualString(anim->mCurAnim, "HipDrop")
-                    || al::isEqualString(anim->mCurAnim, "HipDropPunch")
-                    || al::isEqualString(anim->mCurAnim, "HipDropReaction")
-                    || al::isEqualString(anim->mCurAnim, "HipDropPunchReaction")
-                    || al::isEqualString(anim->mCurAnim, "SpinJumpDownFallL")
-                    || al::isEqualString(anim->mCurAnim, "SpinJumpDownFallR")
-                    || al::isEqualString(anim->mCurAnim, "SwimHipDrop")
-                    || al::isEqualString(anim->mCurAnim, "SwimHipDropPunch")
-                    || al::isEqualString(anim->mCurAnim, "SwimDive"))
-                ) return true;
+                if (AnimTraits::is(thisPtr->mAnimator, AnimTraits::HipDrop)) return true;
             }
             return Orig(thisPtr, msg, source, target);
         }
@@ -256,6 +281,9 @@ namespace PlayerCore {
         // Change Mario's idle
         PlayerStateWaitExeWait::InstallAtSymbol("_ZN15PlayerStateWait7exeWaitEv");
 
+        // Swap in suit animation variants
+        AnimRemap::Install();
+
         // Handles control/movement
         //PlayerControlHook::InstallAtSymbol("_ZN19PlayerActorHakoniwa7controlEv");
         PlayerMovementHook::InstallAtSymbol("_ZN19PlayerActorHakoniwa8movementEv");
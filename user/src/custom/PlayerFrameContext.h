@@ -0,0 +1,75 @@
+#pragma once
+#include "custom/_Globals.h"
+
+// Player queries shared by the movement hook, power-ups and custom nerves.
+// Model parts don't change within a stage and live in playerParts instead.
+// Each value is computed on first use in a frame and kept until begin()
+// opens the next frame. Physics values are dropped with invalidatePhysics()
+// whenever the player may have moved since they were read.
+class PlayerFrameContext {
+public:
+    enum Field : u32 {
+        Move     = 1 << 0,
+        OnGround = 1 << 1,
+        InWater  = 1 << 2,
+        Surface  = 1 << 3,
+        SpeedH   = 1 << 4,
+
+        Physics = OnGround | InWater | Surface | SpeedH,
+    };
+
+    void begin(PlayerActorHakoniwa* player) {
+        mPlayer = player;
+        mFrame++;
+        mValid = 0;
+    }
+
+    // Hooks outside movement start a frame if the player changed
+    PlayerFrameContext& of(PlayerActorHakoniwa* player) {
+        if (player != mPlayer) begin(player);
+        return *this;
+    }
+
+    void invalidatePhysics() { mValid &= ~Physics; }
+    void invalidate()        { mValid = 0; }
+
+    u32 getFrame() const { return mFrame; }
+
+    bool isMove() {
+        if (!(mValid & Move)) { mIsMove = mPlayer->mInput->isMove(); mValid |= Move; }
+        return mIsMove;
+    }
+
+    bool isOnGround() {
+        if (!(mValid & OnGround)) { mIsOnGround = rs::isOnGround(mPlayer, mPlayer->mCollider); mValid |= OnGround; }
+        return mIsOnGround;
+    }
+
+    bool isInWater() {
+        if (!(mValid & InWater)) { mIsInWater = al::isInWater(mPlayer); mValid |= InWater; }
+        return mIsInWater;
+    }
+
+    bool isFoundSurface() {
+        if (!(mValid & Surface)) { mIsSurface = mPlayer->mWaterSurfaceFinder->isFoundSurface(); mValid |= Surface; }
+        return mIsSurface;
+    }
+
+    f32 getSpeedH() {
+        if (!(mValid & SpeedH)) { mSpeedH = al::calcSpeedH(mPlayer); mValid |= SpeedH; }
+        return mSpeedH;
+    }
+
+private:
+    PlayerActorHakoniwa* mPlayer = nullptr;
+    u32 mFrame = 0;
+    u32 mValid = 0;
+
+    bool mIsMove = false;
+    bool mIsOnGround = false;
+    bool mIsInWater = false;
+    bool mIsSurface = false;
+    f32 mSpeedH = 0.0f;
+};
+
+inline PlayerFrameContext frameCtx;
@@ -2,91 +2,160 @@
 
 #include "ModConfig.h"
 #include "custom/_Globals.h"
+#include "custom/ActorClass.h"
+#include "headers/FrozenIndex.h"
 #include "headers/PlayerIceCube.h"
+#include "headers/TimerWheel.h"
 
 namespace PlayerFreeze {
 
-    // Frozen actor tracking
-    struct FrozenState { al::LiveActor* actor; int timer; const char* prevAction; PlayerIceCube* cube; };
-    inline FrozenState frozenList[32];
-    inline int frozenCount = 0;
+    // Frozen actor tracking. Slots keep their id while frozen so the index
+    // and the thaw wheel can refer to them.
+    struct FrozenState { al::LiveActor* actor; const char* prevAction; PlayerIceCube* cube; };
+    inline FrozenState frozenList[FROZEN_ACTOR_MAX];
+    inline s32 freeIds[FROZEN_ACTOR_MAX];
+    inline s32 freeCount = -1;  // free stack not built yet
+    inline FrozenIndex<FROZEN_ACTOR_MAX> frozenIndex;
+    inline TimerWheel<FROZEN_ACTOR_MAX> thawWheel;
+
+    // Sensor updates done and skipped by the LOD, logged per stage
+    struct SensorStats {
+        u32 frames = 0;
+        u32 updates = 0;
+        u32 saved = 0;      // updates skipped by the LOD
+        u32 framePeak = 0;  // most updates saved in one frame
+        u32 frameSaved = 0;
+    };
+    inline SensorStats sensorStats = {};
+
+    inline void logSensorStats() {
+        if (!sensorStats.frames) return;
+
+        logLine("Frozen sensors: %u frames, %u updates, %u saved (%u per frame avg, %u peak)",
+            sensorStats.frames, sensorStats.updates, sensorStats.saved,
+            sensorStats.saved / sensorStats.frames, sensorStats.framePeak);
+        sensorStats = {};
+    }
+
+    // Called when the player is (re)initialized; the previous actors are gone
+    inline void clear() {
+        logSensorStats();
+        for (s32 i = 0; i < FROZEN_ACTOR_MAX; i++) freeIds[i] = FROZEN_ACTOR_MAX - 1 - i;
+        freeCount = FROZEN_ACTOR_MAX;
+        frozenIndex.clear();
+        thawWheel.clear();
+    }
 
     inline void freezeActor(al::LiveActor* actor, int duration) {
+        if (freeCount < 0) clear();
+
         // Check if already frozen
-        for (int i = 0; i < frozenCount; i++) {
-            if (frozenList[i].actor == actor) return;
-        }
-        
-        // Add to list
-        if (frozenCount < 32) {
-            const char* curAction = al::getActionName(actor);
-            bool isBlowDown = al::tryStartAction(actor, "BlowDown");
-            PlayerIceCube* cube = nullptr;
-
-            if (iceCubes) {
-                cube = (PlayerIceCube*)iceCubes->getDeadActor();
-                if (cube) cube->freeze(actor);
-            }
+        if (frozenIndex.find(actor) >= 0) return;
+        if (freeCount == 0) return;
 
-            frozenList[frozenCount] = { actor, duration, isBlowDown ? curAction : nullptr, cube };
-            frozenCount++;
+        const char* curAction = al::getActionName(actor);
+        bool isBlowDown = al::tryStartAction(actor, "BlowDown");
+        PlayerIceCube* cube = nullptr;
 
-            al::setActionFrameRate(actor, 0.0f);
-            //al::setVelocity(actor, sead::Vector3f::zero);
+        if (iceCubes) {
+            cube = (PlayerIceCube*)iceCubes->getDeadActor();
+            if (cube) cube->freeze(actor);
         }
+
+        const s32 id = freeIds[--freeCount];
+        frozenList[id] = { actor, isBlowDown ? curAction : nullptr, cube };
+        frozenIndex.insert(actor, id);
+        thawWheel.schedule(id, duration);
+
+        al::setActionFrameRate(actor, 0.0f);
+        //al::setVelocity(actor, sead::Vector3f::zero);
     }
 
     inline bool isFrozen(al::LiveActor* actor) {
-        for (int i = 0; i < frozenCount; i++) {
-            if (frozenList[i].actor == actor) return true;
-        }
-        return false;
+        return frozenIndex.find(actor) >= 0;
     }
 
     inline void unfreezeActor(al::LiveActor* actor, bool isTimer = false) {
-        for (int i = 0; i < frozenCount; i++) {
-            if (frozenList[i].actor == actor) {
-            if (frozenList[i].cube) frozenList[i].cube->unfreeze();
+        s32 id = frozenIndex.find(actor);
+        if (id < 0) return;
 
-                al::setActionFrameRate(actor, 1.0f);
-                //al::setVelocity(actor, sead::Vector3f::zero);
+        if (frozenList[id].cube) frozenList[id].cube->unfreeze();
 
-                if (isTimer) {                        
-                    if (frozenList[i].prevAction) al::tryStartAction(actor, frozenList[i].prevAction);
-                }
-                
-                // Remove from list
-                frozenList[i] = frozenList[frozenCount - 1];
-                frozenCount--;
-                return;
+        al::setActionFrameRate(actor, 1.0f);
+        //al::setVelocity(actor, sead::Vector3f::zero);
+
+        if (isTimer) {
+            if (frozenList[id].prevAction) al::tryStartAction(actor, frozenList[id].prevAction);
+        }
+
+        // Release the slot
+        thawWheel.cancel(id);
+        frozenIndex.erase(actor);
+        frozenList[id] = {};
+        freeIds[freeCount++] = id;
+    }
+
+    // Sensor update rate by distance and clipping
+    enum class SensorLod : u8 { Full, Far, Suspended };
+
+    inline SensorLod calcSensorLod(al::LiveActor* actor) {
+        if (al::isClipped(actor)) return SensorLod::Suspended;
+        if (!isHakoniwa) return SensorLod::Full;
+
+        const sead::Vector3f diff = al::getTrans(actor) - al::getTrans(isHakoniwa);
+        return diff.squaredLength() <= FROZEN_SENSOR_NEAR_RADIUS * FROZEN_SENSOR_NEAR_RADIUS ? SensorLod::Full : SensorLod::Far;
+    }
+
+    inline bool isSensorUpdateDue(al::LiveActor* actor, s32 id) {
+        #ifdef ALLOW_FROZEN_SENSOR_LOD
+            switch (calcSensorLod(actor)) {
+                case SensorLod::Full: return true;
+                // Far actors are spread over the interval by slot id
+                case SensorLod::Far: return (thawWheel.getFrame() + id) % FROZEN_SENSOR_FAR_INTERVAL == 0;
+                default: return false;
             }
+        #else
+            return true;
+        #endif
+    }
+
+    // Once per game frame, from the player's movement. Thaws run here so
+    // an actor that is clipped and skips its own movement still thaws on time.
+    inline void tick() {
+        if (frozenIndex.getCount() || sensorStats.frameSaved) {
+            sensorStats.frames++;
+            if (sensorStats.frameSaved > sensorStats.framePeak) sensorStats.framePeak = sensorStats.frameSaved;
         }
+        sensorStats.frameSaved = 0;
+
+        thawWheel.tick([](s32 id) { unfreezeActor(frozenList[id].actor, true); });
     }
 
+    // Runs for every actor in the scene; most are rejected by the index
     inline bool updateFrozenActor(al::LiveActor* actor) {
-        for (int i = 0; i < frozenCount; i++) {
-            if (frozenList[i].actor == actor) {
-            if (frozenList[i].cube && frozenList[i].cube->wasHit()) {
-                unfreezeActor(actor);
-                return false;
-            }
+        s32 id = frozenIndex.find(actor);
+        if (id < 0) return false;
 
-                al::setActionFrameRate(actor, 0.0f);
-                //al::setVelocity(actor, sead::Vector3f::zero);
+        if (frozenList[id].cube && frozenList[id].cube->wasHit()) {
+            unfreezeActor(actor);
+            return false;
+        }
 
-                if (actor->getHitSensorKeeper()) {
-                    actor->getHitSensorKeeper()->update();
-                    actor->getHitSensorKeeper()->attackSensor();
-                }
-                
-                if (--frozenList[i].timer <= 0) {
-                    unfreezeActor(actor, true);
-                    return false;
-                }
+        al::setActionFrameRate(actor, 0.0f);
+        //al::setVelocity(actor, sead::Vector3f::zero);
+
+        if (actor->getHitSensorKeeper()) {
+            if (!isSensorUpdateDue(actor, id)) {
+                sensorStats.saved++;
+                sensorStats.frameSaved++;
                 return true;
             }
+
+            actor->getHitSensorKeeper()->update();
+            actor->getHitSensorKeeper()->attackSensor();
+            sensorStats.updates++;
         }
-        return false;
+        return true;
     }
 
     // Handle freezed enemies attacking Mario
@@ -110,9 +179,9 @@ namespace PlayerFreeze {
             al::LiveActor* sourceHost = al::getSensorHost(source);
             al::LiveActor* targetHost = al::getSensorHost(target);
 
-            bool isMario = sourceHost && al::isEqualSubString(typeid(*sourceHost).name(), "PlayerActorHakoniwa");
-            bool isCappy = sourceHost && al::isEqualSubString(typeid(*sourceHost).name(), "HackCap");
-            bool isIceCube = targetHost && al::isEqualSubString(typeid(*targetHost).name(), "PlayerIceCube");
+            bool isMario = sourceHost && (ActorClass::classify(sourceHost) & ActorClass::PlayerActorHakoniwa);
+            bool isCappy = sourceHost && (ActorClass::classify(sourceHost) & ActorClass::HackCap);
+            bool isIceCube = targetHost && (ActorClass::classify(targetHost) & ActorClass::PlayerIceCube);
 
             if (!isMario && !isCappy) return Orig(message, source, target);
 
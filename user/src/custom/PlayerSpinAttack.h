@@ -2,6 +2,9 @@
 #include "ModConfig.h"
 #include "custom/_Globals.h"
 #include "custom/_Nerves.h"
+#include "custom/AnimTraits.h"
+#include "custom/LatencyTrace.h"
+#include "custom/PadInput.h"
 
 namespace PlayerSpinAttack {
 
@@ -15,28 +18,20 @@ namespace PlayerSpinAttack {
                 if (!rs::isOnGround(player, player->mCollider)) return Orig(actor, port);
             }*/
 
+            // Cap throw keeps whichever of X and Y the spin doesn't use
+            const u16 spinButton = pad::getSpinButton();
             bool canCapThrow = true;
 
-            switch (mallow::config::getConfg<ModOptions>()->spinButton) {
-                case 'Y':
-                    canCapThrow = al::isPadTriggerX(port);
-                    break;
-                case 'X':
-                    canCapThrow = al::isPadTriggerY(port);
-                    break;
-            }
+            if (spinButton == pad::Button::Y) canCapThrow = pad::trigger<pad::Button::X>(port);
+            else if (spinButton == pad::Button::X) canCapThrow = pad::trigger<pad::Button::Y>(port);
             return Orig(actor, port) && canCapThrow;
         }
     };
 
     struct InputIsTriggerActionCameraResetHook : public mallow::hook::Trampoline<InputIsTriggerActionCameraResetHook> {
         static bool Callback(const al::LiveActor* actor, int port) {
-            switch (mallow::config::getConfg<ModOptions>()->spinButton) {
-                case 'L':
-                    return al::isPadTriggerR(port);
-                /*case 'R':
-                    return al::isPadTriggerL(port);*/
-            }
+            if (pad::getSpinButton() == pad::Button::L) return pad::trigger<pad::Button::R>(port);
+            //if (pad::getSpinButton() == pad::Button::R) return pad::trigger<pad::Button::L>(port);
             return Orig(actor, port);
         }
     };
@@ -48,40 +43,26 @@ namespace PlayerSpinAttack {
         prevIsCarry = newIsCarry;
 
         // Fresh spin sequence called from normal input, not from tryCapSpinAndRethrow
-        if (!isSpinRethrow) {
-            canGalaxySpin = true;
-            canStandardSpin = true;
-            isGalaxyAfterStandardSpin = false;
-            isStandardAfterGalaxySpin = false;
-        }
+        if (!spinCtrl.isRethrow()) spinCtrl.send(SpinController::Event::Reset);
 
-        if (isPadTriggerGalaxySpin(-1)
+        if (pad::buffered<pad::Button::Spin>()
             && !rs::is2D(player)
             && !PlayerEquipmentFunction::isEquipmentNoCapThrow(player->mEquipmentUser)
         ) {
-            if (player->mAnimator->isAnim("SpinSeparate")
-            || player->mAnimator->isAnim("SpinSeparateSwim")
-            || player->mAnimator->isAnim("SpinAttackLeft")
-            || player->mAnimator->isAnim("SpinAttackRight")
-            || player->mAnimator->isAnim("SpinAttackAirLeft")
-            || player->mAnimator->isAnim("SpinAttackAirRight")
-            || player->mAnimator->isAnim("KoopaCapPunchL")
-            || player->mAnimator->isAnim("KoopaCapPunchR")
-            || player->mAnimator->isAnim("KoopaCapPunchFinishL")
-            || player->mAnimator->isAnim("KoopaCapPunchFinishR")        
-            || player->mAnimator->isAnim("RabbitGet")
-            || player->mAnimator->isAnim("Kick")
-            || player->mAnimator->isAnim("CapeAttack")
-            || player->mAnimator->isAnim("TailAttack")) return -1;
-
-            if (canGalaxySpin) triggerGalaxySpin = true;
-            else { triggerGalaxySpin = true; galaxyFakethrowRemainder = -2; }
+            if (AnimTraits::is(player->mAnimator, AnimTraits::SpinSeparate
+                | AnimTraits::DoubleSpin
+                | AnimTraits::Punch
+                | AnimTraits::CapeOrTail)) return -1;
+
+            pad::consume<pad::Button::Spin>();
+            LatencyTrace::tag(LatencyTracer::Spin, LatencyTracer::Accept);
+            spinCtrl.requestGalaxy();
             return 1;
         }
 
         if (isFireThrowing()) return -1;
 
-        if (al::isPadTriggerR(-1)
+        if (pad::trigger<pad::Button::R>()
             && !rs::is2D(player)
             && !player->mCarryKeeper->isCarry()
             && !PlayerEquipmentFunction::isEquipmentNoCapThrow(player->mEquipmentUser)) canFireball = true;
@@ -96,7 +77,7 @@ namespace PlayerSpinAttack {
                 case 1:  return true;
                 case -1: return false;
             }
-            if(Orig(player, a2)) { triggerGalaxySpin = false; return true; }
+            if(Orig(player, a2)) { spinCtrl.send(SpinController::Event::CancelRequest); return true; }
             return false;
         }
     };
@@ -108,7 +89,7 @@ namespace PlayerSpinAttack {
                 case 1:  return true;
                 case -1: return false;
             }
-            if(Orig(player, a2)) { triggerGalaxySpin = false; return true; }
+            if(Orig(player, a2)) { spinCtrl.send(SpinController::Event::CancelRequest); return true; }
             return false;
         }
     };
@@ -120,39 +101,27 @@ namespace PlayerSpinAttack {
             const bool forcedGroundSpin = state->mTrigger->isOn(PlayerTrigger::EActionTrigger_val33);
 
             // Safety fix: clear leftover spin state from area load mid-spin
-            if (galaxyFakethrowRemainder != -1 &&
+            if (spinCtrl.isFake() &&
                 !al::isNerve(state, &GalaxySpinGround) &&
                 !al::isNerve(state, &GalaxySpinAir)) {
-                galaxyFakethrowRemainder = -1;
-                isGalaxySpin = false;
-                // DO NOT reset triggerGalaxySpin here!
+                spinCtrl.clearFake();
+                spinCtrl.send(SpinController::Event::End);
+                // The pending request stays
             }
+            const bool isFakeRequested = spinCtrl.getFake() == SpinController::Fake::Requested;
 
-            // Handle cross-spin transition flags
-            if (isGalaxyAfterStandardSpin) {
-                isGalaxyAfterStandardSpin = false;
-                canStandardSpin = false;
-                triggerGalaxySpin = true;
-            }
-            if (isStandardAfterGalaxySpin) {
-                isStandardAfterGalaxySpin = false;
-                canGalaxySpin = false;
-                triggerGalaxySpin = false;
-            }
+            // Queued cross spins and requests resolve here
+            spinCtrl.send(SpinController::Event::Appear);
 
             // If not a GalaxySpin, run original cap throw logic
-            if (!triggerGalaxySpin) {
-                canStandardSpin = false;
-                isGalaxySpin = false;
+            if (!spinCtrl.isGalaxy()) {
                 Orig(state); // Mario goes full 2017
                 return;
             }
 
             // Now we’re in GalaxySpin mode
-            hitBufferCount = 0;
-            isGalaxySpin = true;
-            canGalaxySpin = false;
-            triggerGalaxySpin = false;
+            LatencyTrace::tag(LatencyTracer::Spin, LatencyTracer::Appear);
+            hitBuffer.reset();
 
             // Reset internal flags
             state->mIsDead = false;
@@ -176,7 +145,7 @@ namespace PlayerSpinAttack {
                 al::setNerve(state, &GalaxySpinGround);
             } else {
                 state->_78 = 1;
-                if (isGalaxySpin && galaxyFakethrowRemainder == -2)
+                if (isFakeRequested)
                     al::setNerve(state, getNerveAt(nrvSpinCapFall));
                 else
                     al::setNerve(state, &GalaxySpinAir);
@@ -189,13 +158,13 @@ namespace PlayerSpinAttack {
             Orig(state);
 
             isPunching = false;
-            isSpinActive = false;
+            spinCtrl.setActive(false);
             isNearCollectible = false;
             isNearTreasure = false;
             isNearSwoonedEnemy = false;
 
-            galaxyFakethrowRemainder = -1; 
-            al::invalidateHitSensor(state->mActor, "Punch");
+            spinCtrl.clearFake();
+            PlayerSensors::invalidate(sensors.punch);
         }
     };
 
@@ -203,7 +172,7 @@ namespace PlayerSpinAttack {
         static void Callback(PlayerStateSpinCap* state) {
             Orig(state);
             // If fakethrow is active and the current animation is "SpinSeparate"
-            if (galaxyFakethrowRemainder != -1 && state->mAnimator->isAnim("SpinSeparate")) {
+            if (spinCtrl.isFake() && state->mAnimator->isAnim("SpinSeparate")) {
                 bool onGround = rs::isOnGround(state->mActor, state->mCollider);
                 if (onGround) {
                     // Transition to the ground spin nerve without restarting the animation.
@@ -213,18 +182,14 @@ namespace PlayerSpinAttack {
                 }
             }
             // Normal FakeSpin timer logic for when still airborne:
-            if (galaxyFakethrowRemainder == -2) {
-                galaxyFakethrowRemainder = 21;
-                al::validateHitSensor(state->mActor, "GalaxySpin");
+            if (spinCtrl.getFake() == SpinController::Fake::Requested) {
+                PlayerSensors::validate(sensors.galaxySpin);
                 // Start the SpinSeparate animation if it hasn't been started yet.
                 //state->mAnimator->startSubAnim("SpinSeparate");
                 state->mAnimator->startAnim("SpinSeparate");
-                galaxySensorRemaining = 21;
-            } else if (galaxyFakethrowRemainder > 0) {
-                galaxyFakethrowRemainder--;
-            } else if (galaxyFakethrowRemainder == 0) {
-                galaxyFakethrowRemainder = -1;
-                al::invalidateHitSensor(state->mActor, "GalaxySpin");
+                spinCtrl.startFake(21);
+            } else if (spinCtrl.tickFake()) {
+                PlayerSensors::invalidate(sensors.galaxySpin);
             }
         }
     };
@@ -250,12 +215,9 @@ namespace PlayerSpinAttack {
     struct PlayerStateSpinCapIsEnableCancelGround : public mallow::hook::Trampoline<PlayerStateSpinCapIsEnableCancelGround> {
         static bool Callback(PlayerStateSpinCap* state) {
             // Check if Mario is in the GalaxySpinGround nerve and performing the SpinSeparate move
-            bool isSpin = state->mAnimator->isAnim("SpinSeparate")
-                || state->mAnimator->isAnim("SpinSeparateSwim")
-                || state->mAnimator->isAnim("SpinAttackLeft")
-                || state->mAnimator->isAnim("SpinAttackRight")
-                || state->mAnimator->isAnim("CapeAttack")
-                || state->mAnimator->isAnim("TailAttack");
+            bool isSpin = AnimTraits::is(state->mAnimator, AnimTraits::SpinSeparate
+                | AnimTraits::DoubleSpinGround
+                | AnimTraits::CapeOrTail);
 
             // Allow canceling only if Mario is in the SpinSeparate move
             return Orig(state) || (al::isNerve(state, &GalaxySpinGround) && isSpin && al::isGreaterStep(state, 10));
@@ -264,7 +226,7 @@ namespace PlayerSpinAttack {
 
     struct PlayerSpinCapAttackIsSeparateSingleSpin : public mallow::hook::Trampoline<PlayerSpinCapAttackIsSeparateSingleSpin> {
         static bool Callback(PlayerStateSwim* thisPtr) {
-            if(triggerGalaxySpin) {
+            if(spinCtrl.isRequested()) {
                 return true;
             }
             return Orig(thisPtr);
@@ -274,23 +236,22 @@ namespace PlayerSpinAttack {
     struct PlayerStateSwimExeSwimSpinCap : public mallow::hook::Trampoline<PlayerStateSwimExeSwimSpinCap> {
         static void Callback(PlayerStateSwim* thisPtr) {
             Orig(thisPtr);
-            if(triggerGalaxySpin && al::isFirstStep(thisPtr)) {
-                al::validateHitSensor(thisPtr->mActor, "GalaxySpin");
-                hitBufferCount = 0;
-                isGalaxySpin = true;
-                triggerGalaxySpin = false;
-                isSpinActive = true;
-
-                if (isNearCollectible || isNearTreasure || isNearSwoonedEnemy) al::validateHitSensor(thisPtr->mActor, "Punch");
+            if(spinCtrl.isRequested() && al::isFirstStep(thisPtr)) {
+                PlayerSensors::validate(sensors.galaxySpin);
+                hitBuffer.reset();
+                spinCtrl.send(SpinController::Event::SwimStart);
+                spinCtrl.setActive(true);
+
+                if (isNearCollectible || isNearTreasure || isNearSwoonedEnemy) PlayerSensors::validate(sensors.punch);
             }
 
-            if(isGalaxySpin && (al::isGreaterStep(thisPtr, 15) || al::isStep(thisPtr, -1)))
-                al::invalidateHitSensor(thisPtr->mActor, "Punch");
+            if(spinCtrl.isGalaxy() && (al::isGreaterStep(thisPtr, 15) || al::isStep(thisPtr, -1)))
+                PlayerSensors::invalidate(sensors.punch);
 
-            if(isGalaxySpin && (al::isGreaterStep(thisPtr, 32) || al::isStep(thisPtr, -1))) {
-                al::invalidateHitSensor(thisPtr->mActor, "GalaxySpin");
-                isGalaxySpin = false;
-                isSpinActive = false;
+            if(spinCtrl.isGalaxy() && (al::isGreaterStep(thisPtr, 32) || al::isStep(thisPtr, -1))) {
+                PlayerSensors::invalidate(sensors.galaxySpin);
+                spinCtrl.send(SpinController::Event::End);
+                spinCtrl.setActive(false);
             }
         }
     };
@@ -298,23 +259,22 @@ namespace PlayerSpinAttack {
     struct PlayerStateSwimExeSwimSpinCapSurface : public mallow::hook::Trampoline<PlayerStateSwimExeSwimSpinCapSurface> {
         static void Callback(PlayerStateSwim* thisPtr) {
             Orig(thisPtr);
-            if(triggerGalaxySpin && al::isFirstStep(thisPtr)) {
-                al::validateHitSensor(thisPtr->mActor, "GalaxySpin");
-                hitBufferCount = 0;
-                isGalaxySpin = true;
-                triggerGalaxySpin = false;
-                isSpinActive = true;
-
-                if (isNearCollectible || isNearTreasure || isNearSwoonedEnemy) al::validateHitSensor(thisPtr->mActor, "Punch");
+            if(spinCtrl.isRequested() && al::isFirstStep(thisPtr)) {
+                PlayerSensors::validate(sensors.galaxySpin);
+                hitBuffer.reset();
+                spinCtrl.send(SpinController::Event::SwimStart);
+                spinCtrl.setActive(true);
+
+                if (isNearCollectible || isNearTreasure || isNearSwoonedEnemy) PlayerSensors::validate(sensors.punch);
             }
 
-            if(isGalaxySpin && (al::isGreaterStep(thisPtr, 15) || al::isStep(thisPtr, -1)))
-                al::invalidateHitSensor(thisPtr->mActor, "Punch");
+            if(spinCtrl.isGalaxy() && (al::isGreaterStep(thisPtr, 15) || al::isStep(thisPtr, -1)))
+                PlayerSensors::invalidate(sensors.punch);
 
-            if(isGalaxySpin && (al::isGreaterStep(thisPtr, 32) || al::isStep(thisPtr, -1))) {
-                al::invalidateHitSensor(thisPtr->mActor, "GalaxySpin");
-                isGalaxySpin = false;
-                isSpinActive = false;
+            if(spinCtrl.isGalaxy() && (al::isGreaterStep(thisPtr, 32) || al::isStep(thisPtr, -1))) {
+                PlayerSensors::invalidate(sensors.galaxySpin);
+                spinCtrl.send(SpinController::Event::End);
+                spinCtrl.setActive(false);
             }
         }
     };
@@ -322,19 +282,17 @@ namespace PlayerSpinAttack {
     struct PlayerStateSwimKill : public mallow::hook::Trampoline<PlayerStateSwimKill> {
         static void Callback(PlayerStateSwim* state) {
             Orig(state);
-            isGalaxySpin = false;
-            al::invalidateHitSensor(state->mActor, "GalaxySpin");
-            isSpinActive = false;
+            spinCtrl.send(SpinController::Event::End);
+            PlayerSensors::invalidate(sensors.galaxySpin);
+            spinCtrl.setActive(false);
         }
     };
 
     struct PlayerSpinCapAttackStartSpinSeparateSwimSurface : public mallow::hook::Trampoline<PlayerSpinCapAttackStartSpinSeparateSwimSurface> {
         static void Callback(PlayerSpinCapAttack* thisPtr, PlayerAnimator* animator) {
-            auto* holder = isHakoniwa->mModelHolder;
-            auto* model  = holder->findModelActor("Normal");
-            auto* cape = al::tryGetSubActor(model, "ケープ");
+            auto* cape = playerParts.cape;
 
-            if(!isGalaxySpin && !triggerGalaxySpin) {
+            if(!spinCtrl.isGalaxy() && !spinCtrl.isRequested()) {
                 Orig(thisPtr, animator);
                 return;
             }
@@ -349,11 +307,9 @@ namespace PlayerSpinAttack {
 
     struct PlayerSpinCapAttackStartSpinSeparateSwim : public mallow::hook::Trampoline<PlayerSpinCapAttackStartSpinSeparateSwim> {
         static void Callback(PlayerSpinCapAttack* thisPtr, PlayerAnimator* animator) {
-            auto* holder = isHakoniwa->mModelHolder;
-            auto* model  = holder->findModelActor("Normal");
-            auto* cape = al::tryGetSubActor(model, "ケープ");
+            auto* cape = playerParts.cape;
 
-            if(!isGalaxySpin && !triggerGalaxySpin) {
+            if(!spinCtrl.isGalaxy() && !spinCtrl.isRequested()) {
                 Orig(thisPtr, animator);
                 return;
             }
@@ -368,111 +324,65 @@ namespace PlayerSpinAttack {
 
     struct DisallowCancelOnUnderwaterSpinPatch : public mallow::hook::Inline<DisallowCancelOnUnderwaterSpinPatch> {
         static void Callback(exl::hook::InlineCtx* ctx) {
-            if(isGalaxySpin)
+            if(spinCtrl.isGalaxy())
                 ctx->W[20] = true;
         }
     };
 
     struct DisallowCancelOnWaterSurfaceSpinPatch : public mallow::hook::Inline<DisallowCancelOnWaterSurfaceSpinPatch> {
         static void Callback(exl::hook::InlineCtx* ctx) {
-            if(isGalaxySpin)
+            if(spinCtrl.isGalaxy())
                 ctx->W[21] = true;
         }
     };
 
     void tryCapSpinAndRethrow(PlayerActorHakoniwa* player, bool a2) {
-        if(isGalaxySpin) { // currently in GalaxySpin
-            isSpinRethrow = true;
-            bool trySpin = player->tryActionCapSpinAttackImpl(a2);  // try to start another spin, can only succeed for standard throw
-            isSpinRethrow = false;
-
-            if(!trySpin) return;
-
-            if(!isPadTriggerGalaxySpin(-1)) {  // standard throw or fakethrow
-                if(canStandardSpin) {
-                    // tries a standard spin, is allowed to do so
-                    al::setNerve(player, getNerveAt(spinCapNrvOffset));
-                    isStandardAfterGalaxySpin = true;
-                    return;
-                }
-                else {
-                    // tries a standard spin, not allowed to do so
-                    //player->mPlayerSpinCapAttack->tryStartCapSpinAirMiss(player->mPlayerAnimator);
-                    // fakespins on standard spins should not happen in this mod
-                    return;
-                }
-            } else {  // Y pressed => GalaxySpin or fake-GalaxySpin
-                if(galaxyFakethrowRemainder != -1 || player->mAnimator->isAnim("SpinSeparate"))
-                    return;  // already in fakethrow or GalaxySpin
+        const bool isGalaxy = spinCtrl.isGalaxy();
+        const bool isGalaxyInput = pad::buffered<pad::Button::Spin>();  // TryCapSpinPre consumes it
 
-                if(canGalaxySpin) {
-                    // tries a GalaxySpin, is allowed to do so => should never happen, but better safe than sorry
-                    al::setNerve(player, getNerveAt(spinCapNrvOffset));
-                    return;
-                }
-                else {
-                    // tries a GalaxySpin, not allowed to do so
-                    galaxyFakethrowRemainder = -2;
-                    return;
-                }
-            }
+        // try to start another spin: standard throws come from the game, GalaxySpins and fakethrows from TryCapSpinPre
+        spinCtrl.setRethrow(true);
+        bool trySpin = player->tryActionCapSpinAttackImpl(a2);
+        spinCtrl.setRethrow(false);
 
-            // not attempting or allowed to initiate a spin, so check if should be fakethrow
-            if(isPadTriggerGalaxySpin(-1) && galaxyFakethrowRemainder == -1 && !player->mAnimator->isAnim("SpinSeparate")) {
-                // Y button pressed, start a galaxy fakethrow
-                galaxyFakethrowRemainder = -2;
-                return;
-            }
+        if(!trySpin) return;
+
+        if(!isGalaxyInput) {  // standard throw
+            // fakespins on standard spins should not happen in this mod
+            if(!spinCtrl.canStandard()) return;
+
+            al::setNerve(player, getNerveAt(spinCapNrvOffset));
+            if(isGalaxy) spinCtrl.send(SpinController::Event::RethrowStandard);
+            return;
         }
-        else { // currently in standard spin
-            isSpinRethrow = true;
-            bool trySpin = player->tryActionCapSpinAttackImpl(a2);  // try to start another spin, can succeed for GalaxySpin and fakethrow
-            isSpinRethrow = false;
 
-            if(!trySpin) return;
+        // Y pressed => GalaxySpin or fake-GalaxySpin
+        if(spinCtrl.isFake() || player->mAnimator->isAnim("SpinSeparate"))
+            return;  // already in fakethrow or GalaxySpin
 
-            if(!isPadTriggerGalaxySpin(-1)) {  // standard throw or fakethrow
-                if(canStandardSpin) {
-                    // tries a standard spin, is allowed to do so => should never happen, but better safe than sorry
-                    al::setNerve(player, getNerveAt(spinCapNrvOffset));
-                    return;
-                }
-                else {
-                    // tries a standard spin, not allowed to do so
-                    //player->mPlayerSpinCapAttack->tryStartCapSpinAirMiss(player->mPlayerAnimator);
-                    // fakespins on standard spins should not happen in this mod
-                    return;
-                }
-            } else {  // Y pressed => GalaxySpin or fake-GalaxySpin
-                if(galaxyFakethrowRemainder != -1 || player->mAnimator->isAnim("SpinSeparate"))
-                    return;  // already in fakethrow or GalaxySpin
-
-                if(canGalaxySpin) {
-                    // tries a GalaxySpin, is allowed to do so
-                    al::setNerve(player, getNerveAt(spinCapNrvOffset));
-                    isGalaxyAfterStandardSpin = true;
-                    return;
-                }
-                else {
-                    // tries a GalaxySpin, not allowed to do so
-                    galaxyFakethrowRemainder = -2;
-                    return;
-                }
-            }
+        if(!spinCtrl.canGalaxy()) {
+            // tries a GalaxySpin, not allowed to do so
+            spinCtrl.requestFake();
+            return;
         }
+
+        al::setNerve(player, getNerveAt(spinCapNrvOffset));
+        if(!isGalaxy) spinCtrl.send(SpinController::Event::RethrowGalaxy);
     }
 
     struct PlayerActorHakoniwaExeSquat : public mallow::hook::Trampoline<PlayerActorHakoniwaExeSquat> {
         static void Callback(PlayerActorHakoniwa* thisPtr) {
             if (isFireThrowing()) return;
 
-            if (isPadTriggerGalaxySpin(-1)
+            if (pad::buffered<pad::Button::Spin>()
                 && !thisPtr->mAnimator->isAnim("SpinSeparate")
             ) {
+                pad::consume<pad::Button::Spin>();
+                LatencyTrace::tag(LatencyTracer::Spin, LatencyTracer::Accept);
                 if ((isMario || isBrawl)
                     && isHammer && al::isDead(isHammer)) al::setNerve(thisPtr, &HammerNrv);
                 else {
-                    triggerGalaxySpin = true;
+                    spinCtrl.send(SpinController::Event::RequestGalaxy);
                     al::setNerve(thisPtr, getNerveAt(spinCapNrvOffset));
                 }
                 return;
@@ -483,13 +393,15 @@ namespace PlayerSpinAttack {
 
     struct PlayerActorHakoniwaExeRolling : public mallow::hook::Trampoline<PlayerActorHakoniwaExeRolling> {
         static void Callback(PlayerActorHakoniwa* thisPtr) {
-            if (isPadTriggerGalaxySpin(-1)
+            if (pad::buffered<pad::Button::Spin>()
                 && !thisPtr->mAnimator->isAnim("SpinSeparate")
             ) {
+                pad::consume<pad::Button::Spin>();
+                LatencyTrace::tag(LatencyTracer::Spin, LatencyTracer::Accept);
                 if ((isMario || isBrawl)
                     && isHammer && al::isDead(isHammer)) al::setNerve(thisPtr, &HammerNrv);
                 else {
-                    triggerGalaxySpin = true;
+                    spinCtrl.send(SpinController::Event::RequestGalaxy);
                     al::setNerve(thisPtr, getNerveAt(spinCapNrvOffset));
                 }
                 return;
@@ -500,7 +412,7 @@ namespace PlayerSpinAttack {
 
     struct PlayerCarryKeeperStartThrowNoSpin : public mallow::hook::Trampoline<PlayerCarryKeeperStartThrowNoSpin> {
         static bool Callback(PlayerCarryKeeper* state) {
-            if (isSpinActive || galaxySensorRemaining != -1 || galaxyFakethrowRemainder != -1) return false;
+            if (spinCtrl.isBusy()) return false;
             return Orig(state); 
         }
     };
@@ -508,14 +420,14 @@ namespace PlayerSpinAttack {
     struct PlayerCarryKeeperIsCarryDuringSpin : public mallow::hook::Inline<PlayerCarryKeeperIsCarryDuringSpin> {
         static void Callback(exl::hook::InlineCtx* ctx) {
             // if either currently in galaxyspin or already finished galaxyspin while still in-air
-            if(ctx->X[0] && (isGalaxySpin || !canGalaxySpin)) ctx->X[0] = false;
+            if(ctx->X[0] && (spinCtrl.isGalaxy() || !spinCtrl.canGalaxy())) ctx->X[0] = false;
         }
     };
 
     struct PlayerCarryKeeperIsCarryDuringSwimSpin : public mallow::hook::Inline<PlayerCarryKeeperIsCarryDuringSwimSpin> {
         static void Callback(exl::hook::InlineCtx* ctx) {
             // if either currently in galaxyspin
-            if(ctx->X[0] && (isGalaxySpin || triggerGalaxySpin)) ctx->X[0] = false;
+            if(ctx->X[0] && (spinCtrl.isGalaxy() || spinCtrl.isRequested())) ctx->X[0] = false;
         }
     };
 
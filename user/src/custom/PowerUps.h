@@ -2,6 +2,12 @@
 #include "ModConfig.h"
 #include "custom/_Globals.h"
 #include "custom/_Nerves.h"
+#include "custom/AnimTraits.h"
+#include "custom/EffectState.h"
+#include "custom/FxRegistry.h"
+#include "custom/LatencyTrace.h"
+#include "custom/PadInput.h"
+#include "custom/PlayerFrameContext.h"
 #include "custom/PlayerFreeze.h"
 #include "headers/PlayerIceCube.h"
 
@@ -71,7 +77,7 @@ namespace PowerUps {
 
         if (isFireThrowing()) return -1;
 
-        if (al::isPadTriggerR(-1)
+        if (pad::trigger<pad::Button::R>()
             && !rs::is2D(player)
             && !player->mCarryKeeper->isCarry()
             && !PlayerEquipmentFunction::isEquipmentNoCapThrow(player->mEquipmentUser)) canFireball = true;
@@ -86,7 +92,7 @@ namespace PowerUps {
                 case 1:  return true;
                 case -1: return false;
             }
-            if(Orig(player, a2)) { triggerGalaxySpin = false; return true; }
+            if(Orig(player, a2)) { spinCtrl.send(SpinController::Event::CancelRequest); return true; }
             return false;
         }
     };
@@ -98,7 +104,7 @@ namespace PowerUps {
                 case 1:  return true;
                 case -1: return false;
             }
-            if(Orig(player, a2)) { triggerGalaxySpin = false; return true; }
+            if(Orig(player, a2)) { spinCtrl.send(SpinController::Event::CancelRequest); return true; }
             return false;
         }
     };
@@ -111,22 +117,26 @@ namespace PowerUps {
         }
     };
 
-    inline void executeMovement(PlayerActorHakoniwa* thisPtr) {
+    // Movement extras for one suit. Suit checks fold away at compile time.
+    template <SuitKind S>
+    void executeMovementSuit(PlayerActorHakoniwa* thisPtr) {
         #ifdef ALLOW_POWERUPS
+            using Suit = SuitTraits<S>;
+
+            auto& ctx    = frameCtx.of(thisPtr);
             auto* anim   = thisPtr->mAnimator;
-            auto* holder = thisPtr->mModelHolder;
-            auto* model  = holder->findModelActor("Normal");
-            auto* cape = al::tryGetSubActor(model, "ケープ");
-            auto* tail = al::tryGetSubActor(model, "尻尾");
-
-            bool isMove = thisPtr->mInput->isMove();
-            bool onGround = rs::isOnGround(thisPtr, thisPtr->mCollider);
-            bool isWater = al::isInWater(thisPtr);
-            bool isSurface = thisPtr->mWaterSurfaceFinder->isFoundSurface();
+            auto* model  = playerParts.model;
+            auto* cape = playerParts.cape;
+            auto* tail = playerParts.tail;
+
+            bool isMove = ctx.isMove();
+            bool onGround = ctx.isOnGround();
+            bool isWater = ctx.isInWater();
+            bool isSurface = ctx.isFoundSurface();
             bool isVisible = !al::isHideModel(model);
             bool isHack = thisPtr->mHackKeeper && thisPtr->mHackKeeper->mCurrentHackActor;
 
-            f32 speedH = al::calcSpeedH(thisPtr);
+            f32 speedH = ctx.getSpeedH();
             f32 dashBorder = thisPtr->mConst->getDashFastBorderSpeed();
 
             // Handle hammer attack
@@ -135,30 +145,31 @@ namespace PowerUps {
                 && !al::isNerve(thisPtr, &HammerNrv)
             ) {
                 isHammer->makeActorDead();
-                al::invalidateHitSensor(isHammer, "AttackHack");
+                PlayerSensors::invalidate(sensors.hammerAttack);
             }
 
             // Handle fireball attack
-            const char* jointName = nextThrowLeft ? "HandL" : "HandR";
-            const char* fireAnim  = nextThrowLeft ? "FireL" : "FireR";
-
-            al::LiveActorGroup* currentPool = isIce ? iceBalls : fireBalls;
-            auto* projectile = (FireBrosFireBall*) currentPool->getDeadActor();
-
-            bool isFullBody = (!isMove && onGround && (!isWater || isSurface));
             bool isFloating = al::isActionPlaying(model, "GlideFloat")
                 || al::isActionPlaying(model, "GlideFloatSuper");
 
-            if (isMario || isFire || isIce || isBrawl || isSuper
-            ) {
+            if constexpr (Suit::isFireball) {
+                PlayerParts::Joint joint = nextThrowLeft ? PlayerParts::HandL : PlayerParts::HandR;
+                const char* fireAnim  = nextThrowLeft ? "FireL" : "FireR";
+
+                al::LiveActorGroup* currentPool = Suit::isIce ? iceBalls : fireBalls;
+                auto* projectile = (FireBrosFireBall*) currentPool->getDeadActor();
+
+                bool isFullBody = (!isMove && onGround && (!isWater || isSurface));
+
                 if (fireStep < 0
                     && (canFireball || isFloating)
-                    && al::isPadTriggerR(-1)
+                    && pad::trigger<pad::Button::R>()
                 ) {
                     if (projectile && al::isDead(projectile)
                     ) {
                         fireStep = 0;
                         canFireball = false;
+                        LatencyTrace::tag(LatencyTracer::Fireball, LatencyTracer::Accept);
 
                         anim->startUpperBodyAnim(fireAnim);
                         if (isFullBody) anim->startAnim(fireAnim);
@@ -172,15 +183,16 @@ namespace PowerUps {
                     if (!isShooting) { fireStep = -1; return; }
                     if (fireStep == 2
                     ) {
-                        hitBufferCount = 0;
+                        hitBuffer.reset();
 
-                        sead::Vector3f startPos;
-                        al::calcJointPos(&startPos, model, jointName);
+                        sead::Vector3f startPos = al::getTrans(thisPtr);  // kept if there is no model
+                        playerParts.calcJointPos(&startPos, joint);
                         sead::Vector3f offset(0.0f, 0.0f, 0.0f);
                         
-                        if (isSuper) projectile->shoot(startPos, al::getQuat(model), offset, true, 0, true);
+                        if (Suit::isSuper) projectile->shoot(startPos, al::getQuat(model), offset, true, 0, true);
                         else projectile->shoot(startPos, al::getQuat(model), offset, true, 0, false);
-                        al::tryStartSe(thisPtr, "FireBallShoot");
+                        Fx::startSe(thisPtr, Fx::Se::FireBallShoot);
+                        LatencyTrace::end(LatencyTracer::Fireball, LatencyTracer::Shoot);
 
                         nextThrowLeft = !nextThrowLeft;
                     }
@@ -205,7 +217,7 @@ namespace PowerUps {
                 || isFloating;
 
             // Handle glide gauge
-            if (isGauge && !isSuper
+            if (isGauge && !Suit::isSuper
             ) {
                 static bool wasInAir = false;
                 static bool isFirstGlide = true; // Track first glide
@@ -245,22 +257,22 @@ namespace PowerUps {
                 wasInAir = inAir;
             }
 
-            if ((isMario || isBrawl)
+            if (Suit::isCape
                 && cape
             ) {
                 if (al::isDead(cape)) isCapeActive = -1;
                 else if (!isGliding && isCapeActive > 0) {
                     if (--isCapeActive == 0) {
                         cape->kill();
-                        al::tryEmitEffect(model, "AppearBloom", nullptr);
-                        al::tryStartSe(thisPtr, "Bloom");
+                        Fx::emit(model, Fx::Effect::AppearBloom);
+                        Fx::startSe(thisPtr, Fx::Se::Bloom);
                         isCapeActive = -1;
                     }
                 }
             }
 
             // Handle tail logic for Tanooki suit
-            if (isTanooki
+            if (Suit::isTanooki
                 && tail && al::isAlive(tail)
             ) {
                 if (isGliding) {
@@ -281,31 +293,33 @@ namespace PowerUps {
             }
 
             // Handle logic for Super suit
-            if (isSuper) {
-                applyMoonMarioConst(thisPtr->mConst); // force Moon physics
+            if constexpr (Suit::isSuper) {
+                // Moon physics, reapplied only if the game swapped PlayerConst
+                constOverride.follow(thisPtr->mConst);
+                constOverride.set(PlayerConstOverride::Suit, moonMarioConst);
 
                 // Apply attack sensor for DashFastSuper
                 static bool wasMoveSuper = false;
                 bool isMoveSuper = speedH >= dashBorder
-                    || anim->isAnim("JumpBroad8") || anim->isAnim("Glide");
+                    || AnimTraits::is(anim, AnimTraits::Glide);
 
                 if (isMoveSuper != wasMoveSuper
                 ) {
-                    if (isMoveSuper) { al::validateHitSensor(thisPtr, "GalaxySpin"); hitBufferCount = 0; }
-                    else al::invalidateHitSensor(thisPtr, "GalaxySpin");
+                    if (isMoveSuper) { PlayerSensors::validate(sensors.galaxySpin); hitBuffer.reset(); }
+                    else PlayerSensors::invalidate(sensors.galaxySpin);
                 }
                 wasMoveSuper = isMoveSuper;
                 
                 // Apply effects for DashFastSuper
-                bool isDash = al::isPadHoldR(-1) && !isFireThrowing() 
+                bool isDash = pad::hold<pad::Button::R>() && !isFireThrowing() 
                         && al::isActionPlaying(model, "MoveSuper") && speedH >= dashBorder;
                 bool isGlide = al::isActionPlaying(model, "Glide") && !isFireThrowing();
 
-                if (isDash) al::tryEmitEffect(model, "DashSuper", nullptr);
-                else if (isGlide) al::tryEmitEffect(model, "DashSuperGlide", nullptr);
+                if (isDash) EffectState::set(EffectState::DashSuper, true);
+                else if (isGlide) EffectState::set(EffectState::DashSuperGlide, true);
                 else {
-                    al::tryDeleteEffect(model, "DashSuper");
-                    al::tryDeleteEffect(model, "DashSuperGlide");
+                    EffectState::set(EffectState::DashSuper, false);
+                    EffectState::set(EffectState::DashSuperGlide, false);
                 }
                 
                 // Apply effects for Invincibility
@@ -317,10 +331,10 @@ namespace PowerUps {
                         if (!damagekeep->mIsPreventDamage) damagekeep->activatePreventDamage();
                         damagekeep->mRemainingInvincibility = INT_MAX;
                     }
-                    al::tryEmitEffect(model, "Bonfire", nullptr);
+                    EffectState::set(EffectState::Bonfire, true);
                 } else {
                     if (isHack && damagekeep) damagekeep->mRemainingInvincibility = 0;
-                    al::tryDeleteEffect(model, "Bonfire");
+                    EffectState::set(EffectState::Bonfire, false);
                 }
             }
 
@@ -329,7 +343,7 @@ namespace PowerUps {
             static int healFrames = 0;
 
             bool isStill = onGround && isVisible && !isMove;
-            bool canHeal = (isMario || isNoCap) && isStill && !GameDataFunction::isPlayerHitPointMax(thisPtr);
+            bool canHeal = (Suit::isMario || isNoCap) && isStill && !GameDataFunction::isPlayerHitPointMax(thisPtr);
 
             if (canHeal) {
                 if (stillFrames < 120) stillFrames++;
@@ -342,9 +356,9 @@ namespace PowerUps {
             #ifdef ALLOW_DASH // Handles dash animations and effects
                 if (anim && anim->isAnim("JumpDashFast")
                 ) {
-                    if (isBrawl) anim->startAnim("Jump");
+                    if (Suit::isBrawl) anim->startAnim("Jump");
                     else {
-                        bool isFlyingSuit = isFeather || isTanooki || isSuper || (isMario && cape && al::isAlive(cape));
+                        bool isFlyingSuit = Suit::isFeather || Suit::isTanooki || Suit::isSuper || (Suit::isMario && cape && al::isAlive(cape));
                         if (!isFlyingSuit) anim->startAnim("JumpDashFastClassic");
                     }
                 }
@@ -355,19 +369,40 @@ namespace PowerUps {
                     || al::isActionPlaying(model, "MoveSuper");
 
                 static bool wasDash = false;
-                bool isDashNow = al::isPadHoldR(-1)
+                bool isDashNow = pad::hold<pad::Button::R>()
                     && isMoving && !isFireThrowing() && speedH >= dashBorder;
 
                 if (isDashNow && !wasDash
                 ) {
-                    const char* fx = isSuper ? "AccelSecond" : "Accel";
-                    if (!al::isEffectEmitting(model, fx)) { al::tryStartSe(thisPtr, fx); al::tryEmitEffect(model, fx, nullptr); }
+                    const Fx::Effect fx = Suit::isSuper ? Fx::Effect::AccelSecond : Fx::Effect::Accel;
+                    const Fx::Se se = Suit::isSuper ? Fx::Se::AccelSecond : Fx::Se::Accel;
+                    if (!al::isEffectEmitting(model, Fx::effectNames[(u8)fx])) { Fx::startSe(thisPtr, se); Fx::emit(model, fx); }
                 }
                 wasDash = isDashNow;
             #endif
         #endif
     }
 
+    using MovementFunc = void (*)(PlayerActorHakoniwa*);
+
+    inline constexpr MovementFunc movementFuncs[(u8)SuitKind::Num] = {
+        &executeMovementSuit<SuitKind::Other>,
+        &executeMovementSuit<SuitKind::Mario>,
+        &executeMovementSuit<SuitKind::Feather>,
+        &executeMovementSuit<SuitKind::Fire>,
+        &executeMovementSuit<SuitKind::Ice>,
+        &executeMovementSuit<SuitKind::Tanooki>,
+        &executeMovementSuit<SuitKind::Brawl>,
+        &executeMovementSuit<SuitKind::Super>,
+    };
+
+    inline MovementFunc movementFunc = &executeMovementSuit<SuitKind::Other>;
+
+    // Called from initPlayer once the suit is known
+    inline void selectSuit(SuitKind kind) { movementFunc = movementFuncs[(u8)kind]; }
+
+    inline void executeMovement(PlayerActorHakoniwa* thisPtr) { movementFunc(thisPtr); }
+
     struct LiveActorMovementHook : public mallow::hook::Trampoline<LiveActorMovementHook> {
         static void Callback(al::LiveActor* actor) {
             // Check if this actor is frozen
@@ -385,8 +420,8 @@ namespace PowerUps {
                 return;
             }
 
-            al::HitSensor* sensorHammer = al::getHitSensor(isHammer, "AttackHack");
-            if (!sensorHammer || !sensorHammer->mIsValid) return;
+            al::HitSensor* sensorHammer = sensors.hammerAttack;
+            if (!PlayerSensors::isValid(sensorHammer)) return;
 
             if (auto* sensorWall = al::tryGetCollidedWallSensor(isHammer)) isHammer->attackSensor(sensorHammer, sensorWall);
             if (auto* sensorCeiling = al::tryGetCollidedCeilingSensor(isHammer)) isHammer->attackSensor(sensorHammer, sensorCeiling);
@@ -396,9 +431,9 @@ namespace PowerUps {
                 && isHakoniwa->mAnimator->isAnim("HammerAttack")
                 && al::isCollidedGround(isHammer)
             ) {
-                al::tryEmitEffect(isHakoniwa, "HammerLandHit", nullptr);
-                al::tryStartSe(isHakoniwa, "HammerLand");
-                al::tryStartSe(isHakoniwa, "HammerHit");
+                Fx::emit(isHakoniwa, Fx::Effect::HammerLandHit);
+                Fx::startSe(isHakoniwa, Fx::Se::HammerLand);
+                Fx::startSe(isHakoniwa, Fx::Se::HammerHit);
                 hammerEffect = true;
             }
         }
@@ -417,19 +452,21 @@ namespace PowerUps {
 
     struct PlayerActorHakoniwaExeJump : public mallow::hook::Trampoline<PlayerActorHakoniwaExeJump> {
         static void Callback(PlayerActorHakoniwa* thisPtr) {
+            auto& ctx = frameCtx.of(thisPtr);
             auto* anim = thisPtr->mAnimator;
-            auto* model = thisPtr->mModelHolder->findModelActor("Normal");
+            auto* model = playerParts.model;
             auto* keeper = static_cast<al::IUseEffectKeeper*>(model);
 
-            bool wasGround = rs::isOnGround(thisPtr, thisPtr->mCollider);
-            bool wasWater = al::isInWater(thisPtr);
+            bool wasGround = ctx.isOnGround();
+            bool wasWater = ctx.isInWater();
 
             Orig(thisPtr);
+            ctx.invalidatePhysics();
 
             if (!isBrawl) return;
 
-            bool isGround = rs::isOnGround(thisPtr, thisPtr->mCollider);
-            bool isWater = al::isInWater(thisPtr);
+            bool isGround = ctx.isOnGround();
+            bool isWater = ctx.isInWater();
             bool isAir = !isGround && !isWater;
 
             if (wasWater || (wasGround && isAir)
@@ -438,7 +475,7 @@ namespace PowerUps {
                 isDoubleJumpConsume = false;
             }
             if (isAir && !isDoubleJump
-                && (al::isPadTriggerA(-1) || al::isPadTriggerB(-1))
+                && pad::trigger<pad::Button::A | pad::Button::B>()
             ) {
                 isDoubleJump = true;
                 isDoubleJumpConsume = true;
@@ -474,9 +511,8 @@ namespace PowerUps {
             if (blockGlide) return;
 
             auto* anim   = thisPtr->mAnimator;
-            auto* model = thisPtr->mModelHolder->findModelActor("Normal");
-            auto* cape = al::tryGetSubActor(model, "ケープ");
-            auto* keeper = static_cast<al::IUseEffectKeeper*>(model);
+            auto* model = playerParts.model;
+            auto* cape = playerParts.cape;
 
             if (!isMario && !isFeather && !isTanooki && !isBrawl && !isSuper) return;
 
@@ -495,8 +531,8 @@ namespace PowerUps {
                     && cape && al::isDead(cape)
                 ) {
                     cape->appear();
-                    al::tryEmitEffect(keeper, "AppearBloom", nullptr);
-                    al::tryStartSe(thisPtr, "Bloom");
+                    Fx::emit(model, Fx::Effect::AppearBloom);
+                    Fx::startSe(thisPtr, Fx::Se::Bloom);
                 }
                 anim->startAnim(jumpBroadAnim);
             }
@@ -507,40 +543,31 @@ namespace PowerUps {
             }
             if (al::isGreaterStep(thisPtr, 25)
             ) {
-                if (al::isPadTriggerA(-1)
-                    || al::isPadTriggerB(-1)
+                if (pad::trigger<pad::Button::A | pad::Button::B>()
                 ) {
                     if (!al::isNerve(thisPtr, getNerveAt(nrvHakoniwaFall))) al::setNerve(thisPtr, getNerveAt(nrvHakoniwaFall));
                 }
 
-                if (al::isPadTriggerZL(-1)
-                    || al::isPadTriggerZR(-1)
+                if (pad::trigger<pad::Button::ZL | pad::Button::ZR>()
                 ) {
                     if (!al::isNerve(thisPtr, getNerveAt(nrvHakoniwaHipDrop))) al::setNerve(thisPtr, getNerveAt(nrvHakoniwaHipDrop));
                 }
-                if (isPadTriggerGalaxySpin(-1)
+                if (pad::buffered<pad::Button::Spin>()
                 ) {
                     if (!al::isNerve(thisPtr, getNerveAt(spinCapNrvOffset))
                     ) {
-                        canGalaxySpin = true;
-                        canStandardSpin = true;
-                        isGalaxyAfterStandardSpin = false;
-                        isStandardAfterGalaxySpin = false;
-
-                        triggerGalaxySpin = true;
+                        pad::consume<pad::Button::Spin>();
+                        spinCtrl.send(SpinController::Event::Reset);
+                        spinCtrl.send(SpinController::Event::RequestGalaxy);
                         al::setNerve(thisPtr, getNerveAt(spinCapNrvOffset));
                     }
                 }
-                else if (al::isPadTriggerX(-1) || al::isPadTriggerY(-1)
+                else if (pad::trigger<pad::Button::X | pad::Button::Y>()
                 ) {
                     if (!al::isNerve(thisPtr, getNerveAt(spinCapNrvOffset))
                     ) {
-                        canGalaxySpin = true;
-                        canStandardSpin = true;
-                        isGalaxyAfterStandardSpin = false;
-                        isStandardAfterGalaxySpin = false;
-
-                        triggerGalaxySpin = false;
+                        spinCtrl.send(SpinController::Event::Reset);
+                        spinCtrl.send(SpinController::Event::CancelRequest);
                         al::setNerve(thisPtr, getNerveAt(spinCapNrvOffset));
                     }
                 }
@@ -570,7 +597,7 @@ namespace PowerUps {
         static bool Callback(const al::LiveActor* actor, s32 port) {
             bool isFlying = isHakoniwa && isHakoniwa->mHackCap && isHakoniwa->mHackCap->isFlying();
 
-            return Orig(actor, port) || (al::isPadHoldR(port) && !isFlying);
+            return Orig(actor, port) || (pad::hold<pad::Button::R>(port) && !isFlying);
         }
     };
 
@@ -579,24 +606,14 @@ namespace PowerUps {
             float update = Orig(thisPtr);
 
             if (isHakoniwa->mHackKeeper && isHakoniwa->mHackKeeper->mCurrentHackActor) return update;
-            PlayerConst* playerConst = const_cast<PlayerConst*>(thisPtr->mConst);
+            bool isDash = pad::hold<pad::Button::R>() && !isFireThrowing();
 
-            bool isDash = al::isPadHoldR(-1) && !isFireThrowing();
+            // PlayerConst is only written when the dash mode changes
+            if (!isDash) constOverride.clear(PlayerConstOverride::Dash);
+            else if (isSuper) constOverride.set(PlayerConstOverride::Dash, dashSuperConst);
+            else constOverride.set(PlayerConstOverride::Dash, dashConst);
 
-            if (isSuper && isDash
-            ) {
-                playerConst->mNormalMaxSpeed = 28.0f;
-                thisPtr->mMaxSpeed = 28.0f;
-            }
-            else if (isDash
-            ) {
-                playerConst->mNormalMaxSpeed = 21.0f;
-                thisPtr->mMaxSpeed = 21.0f;
-            }
-            else {
-                playerConst->mNormalMaxSpeed = 14.0f;
-                thisPtr->mMaxSpeed = 14.0f;
-            }
+            thisPtr->mMaxSpeed = thisPtr->mConst->mNormalMaxSpeed;
             return update;
         }
     };
@@ -604,37 +621,32 @@ namespace PowerUps {
     struct PlayerAnimControlRunUpdate : public mallow::hook::Inline<PlayerAnimControlRunUpdate> {
         static void Callback(exl::hook::InlineCtx* ctx) {
             if (isHakoniwa->mHackKeeper && isHakoniwa->mHackKeeper->mCurrentHackActor) return;
-            if (isSuper) *reinterpret_cast<u64*>(ctx->X[0] + 0x38) = reinterpret_cast<u64>("MoveSuper"); //mMoveAnimName in PlayerAnimControlRun
-            else if (isBrawl) *reinterpret_cast<u64*>(ctx->X[0] + 0x38) = reinterpret_cast<u64>("MoveBrawl");
-            else if (isFeather || isTanooki) *reinterpret_cast<u64*>(ctx->X[0] + 0x38) = reinterpret_cast<u64>("Move");
-            else *reinterpret_cast<u64*>(ctx->X[0] + 0x38) = reinterpret_cast<u64>("MoveClassic");
+            *reinterpret_cast<u64*>(ctx->X[0] + 0x38) = reinterpret_cast<u64>(suitMoveAnim); //mMoveAnimName in PlayerAnimControlRun
         }
     };
 
     struct PlayerSeCtrlUpdateMove : public mallow::hook::Inline<PlayerSeCtrlUpdateMove> {
         static void Callback(exl::hook::InlineCtx* ctx) {
             if (isHakoniwa->mHackKeeper && isHakoniwa->mHackKeeper->mCurrentHackActor) return;
-            if (isSuper) ctx->X[8] = reinterpret_cast<u64>("MoveSuper");
-            else if (isBrawl) ctx->X[8] = reinterpret_cast<u64>("MoveBrawl");
-            else if (isFeather || isTanooki) ctx->X[8] = reinterpret_cast<u64>("Move");
-            else ctx->X[8] = reinterpret_cast<u64>("MoveClassic");
+            ctx->X[8] = reinterpret_cast<u64>(suitMoveAnim);
         }
     };
 
     struct PlayerSeCtrlUpdateWearEnd : public mallow::hook::Inline<PlayerSeCtrlUpdateWearEnd> {
         static void Callback(exl::hook::InlineCtx* ctx) {
-            if (isBrawl) ctx->X[20] = reinterpret_cast<u64>("WearEndBrawl");
-            if (isSuper) ctx->X[20] = reinterpret_cast<u64>("WearEndSuper");
+            if (suitWearEndAnim) ctx->X[20] = reinterpret_cast<u64>(suitWearEndAnim);
         }
     };
 
     struct StartWaterSurfaceRunJudge : public mallow::hook::Trampoline<StartWaterSurfaceRunJudge> {
         static bool Callback(const PlayerJudgeStartWaterSurfaceRun* thisPtr) {
             if (isSuper) {
-                return thisPtr->mWaterSurfaceFinder->isFoundSurface()
+                // Only the player wears a suit, and its finder is the one the judge holds
+                auto& ctx = frameCtx.of(isHakoniwa);
+                return ctx.isFoundSurface()
                     && al::isNearZeroOrGreater(thisPtr->mWaterSurfaceFinder->getDistance())
                     && al::getGravity(thisPtr->mPlayer).dot(al::getVelocity(thisPtr->mPlayer)) >= 0.0f
-                    && al::calcSpeedH(thisPtr->mPlayer) >= MIN_SPEED_RUN_ON_WATER;
+                    && ctx.getSpeedH() >= MIN_SPEED_RUN_ON_WATER;
             }
             else {
                 return Orig(thisPtr);
@@ -647,9 +659,10 @@ namespace PowerUps {
             isSuperRunningOnSurface = false;
 
             if (isSuper) {
-                bool result = thisPtr->mWaterSurfaceFinder->isFoundSurface()
+                auto& ctx = frameCtx.of(isHakoniwa);
+                bool result = ctx.isFoundSurface()
                     && al::isNearZeroOrGreater(thisPtr->mWaterSurfaceFinder->getDistance())
-                    && al::calcSpeedH(thisPtr->mPlayer) >= MIN_SPEED_RUN_ON_WATER;
+                    && ctx.getSpeedH() >= MIN_SPEED_RUN_ON_WATER;
                 isSuperRunningOnSurface = result;
                 return result;
             }
@@ -0,0 +1,301 @@
+#pragma once
+#include <nn/fs.h>
+#include <exl/nx/kernel/svc.h>
+#include <random/seadGlobalRandom.h>
+#include "ModConfig.h"
+#include "custom/_Globals.h"
+#include "custom/PadInput.h"
+#include "headers/ReplayFile.h"
+
+namespace Replay {
+
+    // Pad input of port -1 and the RNG seed, recorded from a stage load and
+    // fed back through the controller functions on a later run. Every frame
+    // also keeps a hash of the player's state and the ticks of the movement
+    // hook, so two runs can be compared with replay_diff.js.
+    // Hold ZL+ZR and press Up to arm; the take starts on the next stage load
+    // and ends on the one after, on the combo, or at the end of the replay.
+    enum class Mode : u8 { Off, Record, Play };
+
+    inline constexpr const char* recordPath = "sd:/GalaxySpin_replay.bin";
+    inline constexpr const char* playPath = "sd:/GalaxySpin_replay_play.bin";  // what a replay did on this build
+
+    inline constexpr s32 CHUNK_FRAMES = 256;  // frames per file read or write
+    inline constexpr s64 FRAME_OFFSET = sizeof(ReplayHeader);
+
+    inline Mode mode = Mode::Off;
+    inline bool isArmed = false;
+    inline bool isRunning = false;
+
+    inline nn::fs::FileHandle inFile;
+    inline nn::fs::FileHandle outFile;
+    inline ReplayHeader inHeader;
+    inline ReplayHeader outHeader;
+
+    inline ReplayFrame outChunk[CHUNK_FRAMES];
+    inline s32 outCount = 0;
+    inline ReplayFrame inChunk[CHUNK_FRAMES];
+    inline u32 inChunkStart = 0;
+    inline u32 inChunkCount = 0;
+
+    inline ReplayFrame current;  // frame being played
+    inline u16 prevHold = 0;
+    inline u32 frameIndex = 0;
+    inline u64 frameTick = 0;
+
+    inline bool isPlaying() { return isRunning && mode == Mode::Play; }
+    inline bool isRecording() { return isRunning && mode == Mode::Record; }
+
+    inline const sead::Vector2f& toStick(sead::Vector2f& out, const s16* stick) {
+        out.set(ReplayFrame::fromStick(stick[0]), ReplayFrame::fromStick(stick[1]));
+        return out;
+    }
+
+    // Buffered frames. Not flushed, so the movement hook never waits on the
+    // SD card; the header and the flush only happen when the take ends.
+    inline void writeChunk() {
+        if (!outCount) return;
+
+        nn::fs::WriteFile(outFile, FRAME_OFFSET + (s64)outHeader.frameNum * sizeof(ReplayFrame),
+            outChunk, outCount * sizeof(ReplayFrame), nn::fs::WriteOption::CreateOption(0));
+        outHeader.frameNum += outCount;
+        outCount = 0;
+    }
+
+    inline void writeHeader() {
+        nn::fs::WriteFile(outFile, 0, &outHeader, sizeof(outHeader),
+            nn::fs::WriteOption::CreateOption(nn::fs::WriteOptionFlag_Flush));
+    }
+
+    inline bool openOut(const char* path, u32 seed) {
+        nn::fs::DeleteFile(path);
+        if (nn::fs::CreateFile(path, 0).IsFailure()
+            || nn::fs::OpenFile(&outFile, path, nn::fs::OpenMode_Write | nn::fs::OpenMode_Append).IsFailure()
+        ) {
+            logLine("Replay: failed to open %s", path);
+            return false;
+        }
+        outHeader = {};
+        outHeader.frameSize = sizeof(ReplayFrame);
+        outHeader.seed = seed;
+        outCount = 0;
+        writeHeader();
+        return true;
+    }
+
+    inline bool openIn() {
+        if (nn::fs::OpenFile(&inFile, recordPath, nn::fs::OpenMode_Read).IsFailure()) {
+            logLine("Replay: failed to open %s", recordPath);
+            return false;
+        }
+        if (nn::fs::ReadFile(inFile, 0, &inHeader, sizeof(inHeader)).IsFailure()
+            || !inHeader.isValid(sizeof(ReplayFrame))
+        ) {
+            logLine("Replay: %s is not a version %d replay", recordPath, ReplayHeader::VERSION);
+            nn::fs::CloseFile(inFile);
+            return false;
+        }
+
+        // A take that never reached stop() has no frame count, the file size has it
+        s64 fileSize = 0;
+        nn::fs::GetFileSize(&fileSize, inFile);
+        const u32 storedNum = fileSize > FRAME_OFFSET ? (u32)((fileSize - FRAME_OFFSET) / sizeof(ReplayFrame)) : 0;
+        if (!inHeader.frameNum || inHeader.frameNum > storedNum) inHeader.frameNum = storedNum;
+
+        inChunkStart = inChunkCount = 0;
+        return true;
+    }
+
+    // Frame of the replay being played, read a chunk at a time
+    inline bool readFrame(u32 index, ReplayFrame* frame) {
+        if (index >= inHeader.frameNum) return false;
+
+        if (index < inChunkStart || index >= inChunkStart + inChunkCount) {
+            const u32 count = inHeader.frameNum - index < CHUNK_FRAMES ? inHeader.frameNum - index : CHUNK_FRAMES;
+            if (nn::fs::ReadFile(inFile, FRAME_OFFSET + (s64)index * sizeof(ReplayFrame),
+                    inChunk, count * sizeof(ReplayFrame)).IsFailure()) return false;
+            inChunkStart = index;
+            inChunkCount = count;
+        }
+        *frame = inChunk[index - inChunkStart];
+        return true;
+    }
+
+    inline void stop() {
+        if (!isRunning) return;
+
+        writeChunk();
+        writeHeader();
+        nn::fs::CloseFile(outFile);
+        if (mode == Mode::Play) nn::fs::CloseFile(inFile);
+        isRunning = false;
+
+        logLine("Replay: %s stopped after %u frames", mode == Mode::Play ? "replay" : "recording", outHeader.frameNum);
+    }
+
+    inline void start() {
+        const char option = mallow::config::getConfg<ModOptions>()->replay;
+        mode = option == 'r' ? Mode::Record : option == 'p' ? Mode::Play : Mode::Off;
+        if (mode == Mode::Off) return;
+
+        u32 seed = (u32)svcGetSystemTick();
+        if (mode == Mode::Play) {
+            if (!openIn()) return;
+            seed = inHeader.seed;
+        }
+        if (!openOut(mode == Mode::Play ? playPath : recordPath, seed)) {
+            if (mode == Mode::Play) nn::fs::CloseFile(inFile);
+            return;
+        }
+
+        sead::GlobalRandom::instance()->init(seed);
+        current = {};
+        prevHold = 0;
+        frameIndex = 0;
+        isRunning = true;
+
+        logLine("Replay: %s started, seed %08x", mode == Mode::Play ? "replay" : "recording", seed);
+    }
+
+    // From initPlayer: a take spans exactly one stage
+    inline void onStageLoad() {
+        stop();
+        if (isArmed) { isArmed = false; start(); }
+    }
+
+    // Top of the player's frame, before pad::capture
+    inline void beginFrame() {
+        if (!isRunning) return;
+
+        if (mode == Mode::Play) {
+            prevHold = current.hold;
+            if (!readFrame(frameIndex, &current)) { stop(); return; }
+        }
+
+        // After the chunk read, the ticks only cover the movement itself
+        frameTick = svcGetSystemTick();
+    }
+
+    // Right after pad::capture
+    inline void update() {
+        #ifdef ALLOW_INPUT_REPLAY
+            const u16 comboHold = pad::Button::ZL | pad::Button::ZR;
+            if ((pad::getHold(-1) & comboHold) != comboHold || !pad::trigger<pad::Button::Up>()) return;
+
+            if (isRunning) stop();
+            else {
+                isArmed = !isArmed;
+                logLine("Replay: %s", isArmed ? "armed for the next stage load" : "disarmed");
+            }
+        #endif
+    }
+
+    // End of the player's frame
+    inline void endFrame(const al::LiveActor* player) {
+        if (!isRunning) return;
+
+        ReplayFrame frame = current;
+        if (mode == Mode::Record) {
+            frame.trigger = pad::getTrigger(-1) & ~pad::Button::Spin;
+            frame.hold = pad::getHold(-1) & ~pad::Button::Spin;
+
+            // Sticks as the game saw them, already rounded by the stick hooks
+            const sead::Vector2f& left = al::getLeftStick(-1);
+            const sead::Vector2f& right = al::getRightStick(-1);
+            frame.sticks[0] = ReplayFrame::toStick(left.x);
+            frame.sticks[1] = ReplayFrame::toStick(left.y);
+            frame.sticks[2] = ReplayFrame::toStick(right.x);
+            frame.sticks[3] = ReplayFrame::toStick(right.y);
+        }
+
+        ReplayHash hash;
+        hash.add(frame.trigger);
+        hash.add(frame.hold);
+        hash.add(al::getTrans(player));
+        hash.add(al::getVelocity(player));
+        hash.add(spinCtrl.getState());
+        frame.hash = hash.value;
+        frame.ticks = (u32)(svcGetSystemTick() - frameTick);
+
+        outChunk[outCount++] = frame;
+        if (outCount == CHUNK_FRAMES) writeChunk();
+        frameIndex++;
+    }
+
+    // Times the movement hook it lives in
+    struct FrameScope {
+        const al::LiveActor* player;
+
+        FrameScope(const al::LiveActor* player) : player(player) { beginFrame(); }
+        ~FrameScope() { endFrame(player); }
+    };
+
+    // Controller functions answer from the replay while one plays. Every
+    // port gets the input of port -1, replays are single player.
+    template <u16 Button>
+    struct PadTriggerHook : public mallow::hook::Trampoline<PadTriggerHook<Button>> {
+        static bool Callback(s32 port) {
+            if (isPlaying()) return current.trigger & Button;
+            return PadTriggerHook::Orig(port);
+        }
+    };
+
+    template <u16 Button>
+    struct PadHoldHook : public mallow::hook::Trampoline<PadHoldHook<Button>> {
+        static bool Callback(s32 port) {
+            if (isPlaying()) return current.hold & Button;
+            return PadHoldHook::Orig(port);
+        }
+    };
+
+    template <u16 Button>
+    struct PadReleaseHook : public mallow::hook::Trampoline<PadReleaseHook<Button>> {
+        static bool Callback(s32 port) {
+            if (isPlaying()) return prevHold & ~current.hold & Button;
+            return PadReleaseHook::Orig(port);
+        }
+    };
+
+    // Recording rounds the sticks the way they are stored, so the recorded
+    // run and its replay move the same
+    template <s32 Stick>
+    struct StickHook : public mallow::hook::Trampoline<StickHook<Stick>> {
+        static const sead::Vector2f& Callback(s32 port) {
+            static sead::Vector2f stick;
+            if (isPlaying()) return toStick(stick, &current.sticks[Stick * 2]);
+            if (!isRecording()) return StickHook::Orig(port);
+
+            const sead::Vector2f& live = StickHook::Orig(port);
+            const s16 rounded[2] = { ReplayFrame::toStick(live.x), ReplayFrame::toStick(live.y) };
+            return toStick(stick, rounded);
+        }
+    };
+
+    template <u16 Button>
+    inline void installButton(const char* trigger, const char* hold, const char* release) {
+        PadTriggerHook<Button>::InstallAtSymbol(trigger);
+        PadHoldHook<Button>::InstallAtSymbol(hold);
+        PadReleaseHook<Button>::InstallAtSymbol(release);
+    }
+
+    inline void Install() {
+        #ifdef ALLOW_INPUT_REPLAY
+            using Button = pad::Button;
+            installButton<Button::A>("_ZN2al13isPadTriggerAEi", "_ZN2al10isPadHoldAEi", "_ZN2al13isPadReleaseAEi");
+            installButton<Button::B>("_ZN2al13isPadTriggerBEi", "_ZN2al10isPadHoldBEi", "_ZN2al13isPadReleaseBEi");
+            installButton<Button::X>("_ZN2al13isPadTriggerXEi", "_ZN2al10isPadHoldXEi", "_ZN2al13isPadReleaseXEi");
+            installButton<Button::Y>("_ZN2al13isPadTriggerYEi", "_ZN2al10isPadHoldYEi", "_ZN2al13isPadReleaseYEi");
+            installButton<Button::L>("_ZN2al13isPadTriggerLEi", "_ZN2al10isPadHoldLEi", "_ZN2al13isPadReleaseLEi");
+            installButton<Button::R>("_ZN2al13isPadTriggerREi", "_ZN2al10isPadHoldREi", "_ZN2al13isPadReleaseREi");
+            installButton<Button::ZL>("_ZN2al14isPadTriggerZLEi", "_ZN2al11isPadHoldZLEi", "_ZN2al14isPadReleaseZLEi");
+            installButton<Button::ZR>("_ZN2al14isPadTriggerZREi", "_ZN2al11isPadHoldZREi", "_ZN2al14isPadReleaseZREi");
+            installButton<Button::Left>("_ZN2al16isPadTriggerLeftEi", "_ZN2al13isPadHoldLeftEi", "_ZN2al16isPadReleaseLeftEi");
+            installButton<Button::Right>("_ZN2al17isPadTriggerRightEi", "_ZN2al14isPadHoldRightEi", "_ZN2al17isPadReleaseRightEi");
+            installButton<Button::Up>("_ZN2al14isPadTriggerUpEi", "_ZN2al11isPadHoldUpEi", "_ZN2al14isPadReleaseUpEi");
+            installButton<Button::Down>("_ZN2al16isPadTriggerDownEi", "_ZN2al13isPadHoldDownEi", "_ZN2al16isPadReleaseDownEi");
+
+            StickHook<0>::InstallAtSymbol("_ZN2al12getLeftStickEi");
+            StickHook<1>::InstallAtSymbol("_ZN2al13getRightStickEi");
+        #endif
+    }
+}
@@ -69,17 +69,23 @@
 #include "Player/HackCap.h"
 
 // Mod‑specific & custom actors
+#include "headers/ActorHitSet.h"
 #include "headers/CustomGauge.h"
 #include "headers/CustomPlayerConst.h"
 #include "headers/FireBall.h"
 #include "headers/HammerBrosHammer.h"
 #include "headers/PlayerAnimator.h"
+#include "headers/PlayerConstOverride.h"
 #include "headers/PlayerDamageKeeper.h"
 #include "headers/PlayerIceCube.h"
 #include "headers/PlayerJudgeWallHitDown.h"
+#include "headers/PlayerParts.h"
+#include "headers/PlayerSensors.h"
 #include "headers/PlayerStateJump.h"
 #include "headers/PlayerStateWait.h"
 #include "headers/PlayerStainControl.h"
+#include "headers/SpinController.h"
+#include "headers/SuitKind.h"
 #include "ModOptions.h"
 #include "math/seadVectorFwd.h"
 
@@ -107,18 +113,11 @@ const al::Nerve* getNerveAt(uintptr_t offset) {
     return (const al::Nerve*)((((u64)malloc) - 0x00724b94) + offset);
 }
 
-// Configuration
-bool isPadTriggerGalaxySpin(int port) {
-    switch (mallow::config::getConfg<ModOptions>()->spinButton) {
-        case 'L': return al::isPadTriggerL(port);
-        case 'X': return al::isPadTriggerX(port);
-        case 'Y': default: return al::isPadTriggerY(port);
-    }
-}
-
 // Global Buffers
-al::LiveActor* hitBuffer[0x40];
-int hitBufferCount = 0;
+ActorHitSet hitBuffer;
+PlayerSensors sensors;
+PlayerParts playerParts;
+PlayerConstOverride constOverride;
 
 // Offsets
 const uintptr_t spinCapNrvOffset = 0x1d78940;
@@ -129,28 +128,21 @@ const uintptr_t nrvHakoniwaFall = 0x01d78910;
 const uintptr_t nrvHakoniwaHipDrop = 0x1D78978;
 const uintptr_t nrvHakoniwaJump = 0x1D78948;
 
-// Spin Flags
-bool isGalaxySpin = false;
-bool canGalaxySpin = true;
-bool canStandardSpin = true;
-bool isGalaxyAfterStandardSpin = false;
-bool isStandardAfterGalaxySpin = false;
-int galaxyFakethrowRemainder = -1;
-bool triggerGalaxySpin = false;
+// Spin State
+SpinController spinCtrl;
 bool prevIsCarry = false;
-bool isSpinRethrow = false;
-int galaxySensorRemaining = -1;
-bool isSpinActive = false;
 
 // Action Flags
 bool isPunching = false;
 bool isPunchRight = false;
-bool isFinalPunch = false;
 bool isNearCollectible = false;
 bool isNearTreasure = false;
 bool isNearSwoonedEnemy = false;
 
 // Suit Flags
+SuitKind suitKind = SuitKind::Other;
+const char* suitMoveAnim = "MoveClassic";
+const char* suitWearEndAnim = nullptr;
 bool isMario = false;
 bool isNoCap = false;
 bool isFeather = false;
@@ -163,7 +155,6 @@ bool isSuper = false;
 // Actor Pointers
 inline PlayerActorHakoniwa* isHakoniwa = nullptr;
 inline HammerBrosHammer* isHammer = nullptr;
-inline al::LiveActor* isKoopa = nullptr;
 inline al::LiveActorGroup* fireBalls = nullptr;
 inline al::LiveActorGroup* iceBalls = nullptr;
 inline al::LiveActorGroup* iceCubes = nullptr;
@@ -1,6 +1,10 @@
 #pragma once
 #include "ModConfig.h"
 #include "custom/_Globals.h"
+#include "custom/BossState.h"
+#include "custom/EffectState.h"
+#include "custom/LatencyTrace.h"
+#include "custom/PlayerFrameContext.h"
 
 // Custom Nerves
 class PlayerStateSpinCapNrvGalaxySpinAir; 
@@ -11,8 +15,8 @@ public:
     void execute(al::NerveKeeper* keeper) const override {
         PlayerStateSpinCap* state = keeper->getParent<PlayerStateSpinCap>();
         PlayerActorHakoniwa* player = static_cast<PlayerActorHakoniwa*>(state->mActor);
-        auto* model = player->mModelHolder->findModelActor("Normal");
-        auto* cape = al::tryGetSubActor(model, "ケープ");
+        auto* model = playerParts.model;
+        auto* cape = playerParts.cape;
         bool isCape = (isMario && cape && al::isAlive(cape)) || isFeather;
 
         bool isSpinning = state->mAnimator->isAnim("SpinSeparate");
@@ -24,10 +28,11 @@ public:
         bool didSpin = player->mInput->isSpinInput();
         int spinDir = player->mInput->mSpinInputAnalyzer->mSpinDirection;
 
-        isSpinActive = true;
+        spinCtrl.setActive(true);
 
         if (al::isFirstStep(state)
         ) {
+            LatencyTrace::tag(LatencyTracer::Spin, LatencyTracer::FirstStep);
             state->mAnimator->endSubAnim();
             isPunchRight = !isPunchRight;
 
@@ -41,29 +46,29 @@ public:
                         state->mAnimator->startSubAnim("SpinAttackRight");
                         state->mAnimator->startAnim ("SpinAttackRight");
                     }
-                    al::validateHitSensor(state->mActor, "DoubleSpin");
-                    galaxySensorRemaining = 41;
+                    PlayerSensors::validate(sensors.doubleSpin);
+                    spinCtrl.startSensor(41);
                 } else if (isRotatingL) {
                     state->mAnimator->startSubAnim("SpinAttackLeft");
                     state->mAnimator->startAnim("SpinAttackLeft");
-                    al::validateHitSensor(state->mActor, "DoubleSpin");
-                    galaxySensorRemaining = 41;
+                    PlayerSensors::validate(sensors.doubleSpin);
+                    spinCtrl.startSensor(41);
                 } else if (isRotatingR) {
                     state->mAnimator->startSubAnim("SpinAttackRight");
                     state->mAnimator->startAnim("SpinAttackRight");
-                    al::validateHitSensor(state->mActor, "DoubleSpin");
-                    galaxySensorRemaining = 41;
+                    PlayerSensors::validate(sensors.doubleSpin);
+                    spinCtrl.startSensor(41);
                 } else if (isCarrying) {
                     state->mAnimator->startSubAnim("SpinSeparate");
                     state->mAnimator->startAnim("SpinSeparate");
-                    al::validateHitSensor(state->mActor, "GalaxySpin");
-                    galaxySensorRemaining = 21;
+                    PlayerSensors::validate(sensors.galaxySpin);
+                    spinCtrl.startSensor(21);
                 } else if (isNearCollectible) {
                     state->mAnimator->startAnim("RabbitGet");
-                    al::validateHitSensor(state->mActor, "Punch");
+                    PlayerSensors::validate(sensors.punch);
                 } else if (isNearTreasure || isNearSwoonedEnemy) {
                     state->mAnimator->startAnim("Kick");
-                    al::validateHitSensor(state->mActor, "Punch");
+                    PlayerSensors::validate(sensors.punch);
                 } else {
                     if (isCape) {
                         al::setNerve(state, reinterpret_cast<al::Nerve*>(&GalaxySpinAir));
@@ -71,16 +76,16 @@ public:
                     } else if (isTanooki) {
                         state->mAnimator->startSubAnim("TailAttack");
                         state->mAnimator->startAnim("TailAttack");
-                        al::validateHitSensor(state->mActor, "GalaxySpin");
-                        galaxySensorRemaining = 21;
+                        PlayerSensors::validate(sensors.galaxySpin);
+                        spinCtrl.startSensor(21);
                     } else {
                     #ifdef ALLOW_SPIN_ATTACK // Only spin attack
                         state->mAnimator->startSubAnim("SpinSeparate");
                         state->mAnimator->startAnim("SpinSeparate");
-                        al::validateHitSensor(state->mActor, "GalaxySpin");
-                        galaxySensorRemaining = 21;
+                        PlayerSensors::validate(sensors.galaxySpin);
+                        spinCtrl.startSensor(21);
                     #else
-                        if (isFinalPunch) {
+                        if (BossState::consumeFinalPunch()) {
                             if (isPunchRight) {
                                 state->mAnimator->startSubAnim("KoopaCapPunchFinishRStart");
                                 state->mAnimator->startAnim("KoopaCapPunchFinishR");
@@ -88,7 +93,6 @@ public:
                                 state->mAnimator->startSubAnim("KoopaCapPunchFinishLStart");
                                 state->mAnimator->startAnim("KoopaCapPunchFinishL");
                             }
-                            isFinalPunch = false;
                         } else {
                             if (isPunchRight) {
                                 state->mAnimator->startSubAnim("KoopaCapPunchRStart");
@@ -99,9 +103,7 @@ public:
                             }
                         }
                         // Make winding up invincible
-                        al::invalidateHitSensor(state->mActor, "Foot");
-                        al::invalidateHitSensor(state->mActor, "Body");
-                        al::invalidateHitSensor(state->mActor, "Head");
+                        sensors.invalidateBody();
 
                         isPunching = true; // Validate punch animations*/
                     #endif
@@ -130,24 +132,22 @@ public:
             }
             if (al::isStep(state, 6)) {
                 // Make Mario vulnerable again
-                al::validateHitSensor(state->mActor, "Foot");
-                al::validateHitSensor(state->mActor, "Body");
-                al::validateHitSensor(state->mActor, "Head");
-                al::validateHitSensor(state->mActor, "Punch");
-                //galaxySensorRemaining = 15;
+                sensors.validateBody();
+                PlayerSensors::validate(sensors.punch);
+                //spinCtrl.startSensor(15);
             }
         }
         
         if (isFinish) al::setVelocity(player, sead::Vector3f::zero);
         else state->updateSpinGroundNerve();
 
-        if (al::isGreaterStep(state, 41)) al::invalidateHitSensor(state->mActor, "DoubleSpin");
-        if (al::isGreaterStep(state, 21)) al::invalidateHitSensor(state->mActor, "GalaxySpin");
-        if (al::isGreaterStep(state, 15)) al::invalidateHitSensor(state->mActor, "Punch");
+        if (al::isGreaterStep(state, 41)) PlayerSensors::invalidate(sensors.doubleSpin);
+        if (al::isGreaterStep(state, 21)) PlayerSensors::invalidate(sensors.galaxySpin);
+        if (al::isGreaterStep(state, 15)) PlayerSensors::invalidate(sensors.punch);
 
         if (state->mAnimator->isAnimEnd()) {
             state->kill();
-            isSpinActive = false;
+            spinCtrl.setActive(false);
         }
     }
 };
@@ -157,8 +157,8 @@ public:
     void execute(al::NerveKeeper* keeper) const override {
         PlayerStateSpinCap* state = keeper->getParent<PlayerStateSpinCap>();
         PlayerActorHakoniwa* player = static_cast<PlayerActorHakoniwa*>(state->mActor);
-        auto* model = player->mModelHolder->findModelActor("Normal");
-        auto* cape = al::tryGetSubActor(model, "ケープ");
+        auto* model = playerParts.model;
+        auto* cape = playerParts.cape;
         bool isCape = (isMario && cape && al::isAlive(cape)) || isFeather;
 
         bool isRotatingAirL  = state->mAnimator->isAnim("StartSpinJumpL")
@@ -170,18 +170,19 @@ public:
         int spinDir = player->mInput->mSpinInputAnalyzer->mSpinDirection;
         bool isSpinning = state->mAnimator->isAnim("SpinSeparate");
 
-        isSpinActive = true;
+        spinCtrl.setActive(true);
 
         if (state->mAnimator->isAnim("CapeAttack")
             && cape && al::isDead(cape)
         ) {
             state->mAnimator->startAnim("SpinSeparate");
-            al::validateHitSensor(state->mActor, "GalaxySpin"); 
-            galaxySensorRemaining = 21; 
+            PlayerSensors::validate(sensors.galaxySpin); 
+            spinCtrl.startSensor(21); 
         }
         
         if(al::isFirstStep(state)
         ) {
+            LatencyTrace::tag(LatencyTracer::Spin, LatencyTracer::FirstStep);
             const char* cur = state->mAnimator->mCurAnim.cstr();
             if (!al::isEqualSubString(cur, "SpinCap")) state->mAnimator->endSubAnim();
             
@@ -189,32 +190,32 @@ public:
                 if (didSpin) {
                     if (spinDir > 0) state->mAnimator->startAnim("SpinAttackAirLeft");
                     else state->mAnimator->startAnim("SpinAttackAirRight");
-                    al::validateHitSensor(state->mActor, "DoubleSpin");
-                    galaxySensorRemaining = 41;
+                    PlayerSensors::validate(sensors.doubleSpin);
+                    spinCtrl.startSensor(41);
                 } else if (isRotatingAirL) {
                     state->mAnimator->startAnim("SpinAttackAirLeft");
-                    al::validateHitSensor(state->mActor, "DoubleSpin");
-                    galaxySensorRemaining = 41;
+                    PlayerSensors::validate(sensors.doubleSpin);
+                    spinCtrl.startSensor(41);
                 } else if (isRotatingAirR) {
                     state->mAnimator->startAnim("SpinAttackAirRight");
-                    al::validateHitSensor(state->mActor, "DoubleSpin");
-                    galaxySensorRemaining = 41;
+                    PlayerSensors::validate(sensors.doubleSpin);
+                    spinCtrl.startSensor(41);
                 } else if (isCarrying) {
                     state->mAnimator->startAnim("SpinSeparate");
-                    al::validateHitSensor(state->mActor, "GalaxySpin");
-                    galaxySensorRemaining = 21;
+                    PlayerSensors::validate(sensors.galaxySpin);
+                    spinCtrl.startSensor(21);
                 } else if (isCape) {
                     state->mAnimator->startAnim("CapeAttack");
-                    al::validateHitSensor(state->mActor, "GalaxySpin");
-                    galaxySensorRemaining = 21;
+                    PlayerSensors::validate(sensors.galaxySpin);
+                    spinCtrl.startSensor(21);
                 } else if (isTanooki) {
                     state->mAnimator->startAnim("TailAttack");
-                    al::validateHitSensor(state->mActor, "GalaxySpin");
-                    galaxySensorRemaining = 21;
+                    PlayerSensors::validate(sensors.galaxySpin);
+                    spinCtrl.startSensor(21);
                 } else {
                     state->mAnimator->startAnim("SpinSeparate");
-                    al::validateHitSensor(state->mActor, "GalaxySpin");
-                    galaxySensorRemaining = 21;
+                    PlayerSensors::validate(sensors.galaxySpin);
+                    spinCtrl.startSensor(21);
                 }
             }
         }
@@ -224,25 +225,25 @@ public:
         if ((isCape || isTanooki)
             && state->mAnimator->isAnimEnd()
         ) {
-            al::invalidateHitSensor(state->mActor, "GalaxySpin");
+            PlayerSensors::invalidate(sensors.galaxySpin);
             al::setNerve(state, getNerveAt(nrvSpinCapFall));
-            isSpinActive = false;
+            spinCtrl.setActive(false);
             return;
         }
         if (!isSpinning
             && al::isGreaterStep(state, 41)
         ) {
-            al::invalidateHitSensor(state->mActor, "DoubleSpin");
+            PlayerSensors::invalidate(sensors.doubleSpin);
             al::setNerve(state, getNerveAt(nrvSpinCapFall));
-            isSpinActive = false;
+            spinCtrl.setActive(false);
             return;
         }
         if (isSpinning
             && al::isGreaterStep(state, 21)
         ) {
-            al::invalidateHitSensor(state->mActor, "GalaxySpin");
+            PlayerSensors::invalidate(sensors.galaxySpin);
             al::setNerve(state, getNerveAt(nrvSpinCapFall));
-            isSpinActive = false;
+            spinCtrl.setActive(false);
             return;
         }
     }
@@ -278,8 +279,8 @@ public:
     void execute(al::NerveKeeper* keeper) const override {
         auto* player = keeper->getParent<PlayerActorHakoniwa>();
         auto* anim = player->mAnimator;
-        auto* model = player->mModelHolder->findModelActor("Normal");
-        auto* cape = al::tryGetSubActor(model, "ケープ");
+        auto* model = playerParts.model;
+        auto* cape = playerParts.cape;
         auto* effect = static_cast<al::IUseEffectKeeper*>(model);
 
         al::setVelocity(player, sead::Vector3f::zero);
@@ -345,7 +346,7 @@ public:
                     al::tryStartSe(player, "FireOn");
                 }
                 if (isFire || isSuper) {
-                    al::tryEmitEffect(effect, "BonfireSuper", nullptr);
+                    EffectState::set(EffectState::BonfireSuper, true);
                     al::tryStartSe(player, "FireOn");
                 }
                 if (isSuper) {
@@ -359,7 +360,7 @@ public:
         if (anim->isAnimEnd()
         ) {
             tauntRightAlt = false;
-            al::tryDeleteEffect(effect, "BonfireSuper");
+            EffectState::set(EffectState::BonfireSuper, false);
             al::tryDeleteEffect(effect, "IceEffect");
             al::tryStopSe(player, "FireOn", -1, nullptr);
             al::tryStopSe(player, "IceOn", -1, nullptr);
@@ -373,15 +374,19 @@ class PlayerActorHakoniwaNrvHammer : public al::Nerve {
 public:
     void execute(al::NerveKeeper* keeper) const override {
         auto* player = keeper->getParent<PlayerActorHakoniwa>();
-        auto* model = player->mModelHolder->findModelActor("Normal");
-        auto* hammer = al::tryGetSubActor(model, "Hammer");
+        auto* hammer = playerParts.hammer;
 
-        bool isGround = rs::isOnGround(player, player->mCollider);
-        bool isWater = al::isInWater(player);
-        bool isSurface = player->mWaterSurfaceFinder->isFoundSurface();
+        auto& ctx = frameCtx.of(player);
+        bool isGround = ctx.isOnGround();
+        bool isWater = ctx.isInWater();
+        bool isSurface = ctx.isFoundSurface();
 
-        const sead::Matrix34f* mL = al::getJointMtxPtr(model, "ArmL2");
-        const sead::Matrix34f* mR = al::getJointMtxPtr(model, "ArmR2");
+        const sead::Matrix34f* mL = playerParts.getJointMtx(PlayerParts::ArmL2);
+        const sead::Matrix34f* mR = playerParts.getJointMtx(PlayerParts::ArmR2);
+        if (!mL || !mR) {
+            al::setNerve(player, getNerveAt(nrvHakoniwaFall));
+            return;
+        }
 
         sead::Vector3 posL = mL->getTranslation();
         sead::Vector3 posR = mR->getTranslation();
@@ -398,7 +403,7 @@ public:
         if (al::isFirstStep(player)
         ) {
             player->mAnimator->endSubAnim();
-            hitBufferCount = 0;
+            hitBuffer.reset();
 
             if (hammer) al::hideModelIfShow(hammer);
 
@@ -415,7 +420,7 @@ public:
 
             if (!isGround) {
                 player->mAnimator->startAnim("RollingStart");
-                al::validateHitSensor(isHammer, "AttackHack");
+                PlayerSensors::validate(sensors.hammerAttack);
             } else {
                 player->mAnimator->startAnim("HammerAttack");
             }
@@ -447,14 +452,14 @@ public:
 
         if (!isGround) al::addVelocity(player, (al::getGravity(player) * 0.5f));
 
-        if (al::isStep(player, 6)) al::validateHitSensor(isHammer, "AttackHack");
+        if (al::isStep(player, 6)) PlayerSensors::validate(sensors.hammerAttack);
         
         if (player->mAnimator->isAnimEnd()
         ) {
             isHammer->makeActorDead();
             if (hammer) al::showModelIfHide(hammer);
             al::offCollide(isHammer);
-            al::invalidateHitSensor(isHammer, "AttackHack");
+            PlayerSensors::invalidate(sensors.hammerAttack);
             al::setNerve(player, getNerveAt(nrvHakoniwaFall));
             return;
         }
@@ -463,7 +468,7 @@ public:
             isHammer->makeActorDead();
             if (hammer) al::showModelIfHide(hammer);
             al::offCollide(isHammer);
-            al::invalidateHitSensor(isHammer, "AttackHack");
+            PlayerSensors::invalidate(sensors.hammerAttack);
             al::setNerve(player, getNerveAt(nrvHakoniwaFall));
             al::tryEmitEffect(isHammer, "Break", nullptr);
             return;
@@ -473,14 +478,13 @@ public:
 
     void executeOnEnd(al::NerveKeeper* keeper) const override {
         auto* player = keeper->getParent<PlayerActorHakoniwa>();
-        auto* model  = player->mModelHolder->findModelActor("Normal");
-        auto* hammer = al::tryGetSubActor(model, "Hammer");
+        auto* hammer = playerParts.hammer;
 
         if (hammer) al::showModelIfHide(hammer);
 
         if (isHammer) {
             al::offCollide(isHammer);
-            al::invalidateHitSensor(isHammer, "AttackHack");
+            PlayerSensors::invalidate(sensors.hammerAttack);
             isHammer->makeActorDead();
         }
     }
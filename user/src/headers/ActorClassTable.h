@@ -0,0 +1,180 @@
+#pragma once
+#include <basis/seadTypes.h>
+
+// Compile-time part of ActorClass: trait bits and the perfect-hash table of
+// known RTTI names. Kept apart from custom/ActorClass.h so host tests can
+// include it without the game headers.
+namespace ActorClass {
+
+    // One bit per RTTI name fragment the attack hooks care about.
+    // A class carries every trait whose fragment is a substring of its name,
+    // so "CapSwitchTimer" is both CapSwitch and CapSwitchTimer, exactly like
+    // the old isEqualSubString ladder.
+    enum Trait : u64 {
+        None                = 0,
+        KoopaCap            = 1ull << 0,
+        FireBall            = 1ull << 1,
+        PlayerIceCube       = 1ull << 2,
+        Stake               = 1ull << 3,
+        Radish              = 1ull << 4,
+        BossRaidRivet       = 1ull << 5,
+        TreasureBox         = 1ull << 6,
+        BlockQuestion       = 1ull << 7,
+        BlockBrick          = 1ull << 8,
+        BossForestBlock     = 1ull << 9,
+        Koopa               = 1ull << 10,
+        BlockHard           = 1ull << 11,
+        GolemClimb          = 1ull << 12,
+        MarchingCubeBlock   = 1ull << 13,
+        BreakMapParts       = 1ull << 14,
+        BreakableWall       = 1ull << 15,
+        CatchBomb           = 1ull << 16,
+        DamageBall          = 1ull << 17,
+        KickStone           = 1ull << 18,
+        KoopaDamageBall     = 1ull << 19,
+        MoonBasement        = 1ull << 20,
+        PlayGuideBoard      = 1ull << 21,
+        SignBoard           = 1ull << 22,
+        BreedaWanwan        = 1ull << 23,
+        TRex                = 1ull << 24,
+        CapSwitch           = 1ull << 25,
+        CapSwitchTimer      = 1ull << 26,
+        Car                 = 1ull << 27,
+        ChurchDoor          = 1ull << 28,
+        CollapseSandHill    = 1ull << 29,
+        Doshi               = 1ull << 30,
+        ReactionObject      = 1ull << 31,
+        YoshiFruit          = 1ull << 32,
+        HipDrop             = 1ull << 33,
+        FrailBox            = 1ull << 34,
+        Souvenir            = 1ull << 35,
+        PlayerActorHakoniwa = 1ull << 36,
+        HackCap             = 1ull << 37,
+    };
+
+    struct Pattern { const char* fragment; u64 trait; };
+
+    inline constexpr Pattern patterns[] = {
+        { "KoopaCap", KoopaCap },               { "FireBall", FireBall },
+        { "PlayerIceCube", PlayerIceCube },     { "Stake", Stake },
+        { "Radish", Radish },                   { "BossRaidRivet", BossRaidRivet },
+        { "TreasureBox", TreasureBox },         { "BlockQuestion", BlockQuestion },
+        { "BlockBrick", BlockBrick },           { "BossForestBlock", BossForestBlock },
+        { "Koopa", Koopa },                     { "BlockHard", BlockHard },
+        { "GolemClimb", GolemClimb },           { "MarchingCubeBlock", MarchingCubeBlock },
+        { "BreakMapParts", BreakMapParts },     { "BreakableWall", BreakableWall },
+        { "CatchBomb", CatchBomb },             { "DamageBall", DamageBall },
+        { "KickStone", KickStone },             { "KoopaDamageBall", KoopaDamageBall },
+        { "MoonBasement", MoonBasement },       { "PlayGuideBoard", PlayGuideBoard },
+        { "SignBoard", SignBoard },             { "BreedaWanwan", BreedaWanwan },
+        { "TRex", TRex },                       { "CapSwitch", CapSwitch },
+        { "CapSwitchTimer", CapSwitchTimer },   { "Car", Car },
+        { "ChurchDoor", ChurchDoor },           { "CollapseSandHill", CollapseSandHill },
+        { "Doshi", Doshi },                     { "ReactionObject", ReactionObject },
+        { "YoshiFruit", YoshiFruit },           { "HipDrop", HipDrop },
+        { "FrailBox", FrailBox },               { "Souvenir", Souvenir },
+        { "PlayerActorHakoniwa", PlayerActorHakoniwa }, { "HackCap", HackCap },
+    };
+
+    // Classes we expect to see as attack targets. Their trait masks are baked
+    // at compile time; anything else falls back to the substring scan.
+    inline constexpr const char* knownClasses[] = {
+        "BlockHard", "BlockQuestion", "BlockBrick", "BlockBrick2D", "BossForestBlock",
+        "BossRaidRivet", "BreakMapParts", "BreakableWall", "BreedaWanwan", "CapSwitch",
+        "CapSwitchTimer", "Car", "CatchBomb", "ChurchDoor", "CollapseSandHill",
+        "DamageBall", "Doshi", "FireBrosFireBall", "FrailBox", "GolemClimb",
+        "HackCap", "KickStone", "Koopa", "KoopaCap", "KoopaDamageBall",
+        "MarchingCubeBlock", "MoonBasement", "PlayGuideBoard", "PlayerActorHakoniwa", "PlayerIceCube",
+        "Radish", "ReactionObject", "SignBoard", "Souvenir", "Stake",
+        "TRex", "TreasureBox", "YoshiFruit", "HammerBrosHammer", "Kuribo",
+    };
+
+    inline constexpr int knownCount = sizeof(knownClasses) / sizeof(knownClasses[0]);
+    inline constexpr u32 slotCount = 256;
+
+    constexpr bool isSubString(const char* str, u32 len, const char* sub) {
+        for (u32 i = 0; i < len; i++) {
+            u32 j = 0;
+            while (sub[j] && i + j < len && str[i + j] == sub[j]) j++;
+            if (!sub[j]) return true;
+        }
+        return false;
+    }
+
+    constexpr u32 strLength(const char* str) {
+        u32 len = 0;
+        while (str[len]) len++;
+        return len;
+    }
+
+    constexpr u64 calcTraits(const char* name, u32 len) {
+        u64 traits = None;
+        for (const Pattern& p : patterns)
+            if (isSubString(name, len, p.fragment)) traits |= p.trait;
+        return traits;
+    }
+
+    constexpr u32 calcHash(const char* name, u32 len, u32 seed) {
+        u32 h = 2166136261u ^ seed;
+        for (u32 i = 0; i < len; i++) { h ^= (u8)name[i]; h *= 16777619u; }
+        return (h ^ (h >> 15)) & (slotCount - 1);
+    }
+
+    struct HashTable {
+        u32 seed = 0;
+        u8 slots[slotCount] = {};   // knownClasses index + 1, 0 = empty
+        u64 traits[knownCount] = {};
+    };
+
+    // Searches for a seed that maps every known class to its own slot.
+    consteval HashTable buildTable() {
+        HashTable table;
+        for (u32 seed = 1;; seed++) {
+            for (u8& s : table.slots) s = 0;
+            bool isPerfect = true;
+            for (int i = 0; i < knownCount && isPerfect; i++) {
+                const char* name = knownClasses[i];
+                u32 slot = calcHash(name, strLength(name), seed);
+                if (table.slots[slot]) isPerfect = false;
+                else table.slots[slot] = (u8)(i + 1);
+            }
+            if (isPerfect) {
+                table.seed = seed;
+                for (int i = 0; i < knownCount; i++)
+                    table.traits[i] = calcTraits(knownClasses[i], strLength(knownClasses[i]));
+                return table;
+            }
+        }
+    }
+
+    inline constexpr HashTable table = buildTable();
+
+    constexpr bool isEqualName(const char* a, u32 len, const char* b) {
+        for (u32 i = 0; i < len; i++)
+            if (a[i] != b[i]) return false;
+        return b[len] == '\0';
+    }
+
+    // Takes an Itanium RTTI name ("9BlockHard", "N2al9LiveActorE", ...).
+    constexpr u64 classify(const char* rttiName) {
+        if (!rttiName) return None;
+
+        // Only unqualified names ("<len><name>") can be known classes
+        if (rttiName[0] >= '0' && rttiName[0] <= '9') {
+            const char* name = rttiName;
+            u32 len = 0;
+            while (*name >= '0' && *name <= '9') len = len * 10 + (*name++ - '0');
+
+            u8 index = table.slots[calcHash(name, len, table.seed)];
+            if (index && isEqualName(name, len, knownClasses[index - 1])) return table.traits[index - 1];
+        }
+
+        return calcTraits(rttiName, strLength(rttiName));
+    }
+
+    static_assert(classify("9BlockHard") == BlockHard);
+    static_assert(classify("14CapSwitchTimer") == (CapSwitch | CapSwitchTimer));
+    static_assert(classify("15KoopaDamageBall") == (Koopa | DamageBall | KoopaDamageBall));
+    static_assert(classify("13BlockBrickBig") == BlockBrick);
+    static_assert(classify("N2al9LiveActorE") == None);
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <basis/seadTypes.h>
+
+namespace al {
+class LiveActor;
+}
+
+// Set of actors already hit during the current attack window.
+// Slots are stamped with the epoch they were written in, so reset() only
+// bumps the epoch instead of clearing the table.
+class ActorHitSet {
+public:
+    static constexpr s32 SLOT_NUM    = 512;
+    static constexpr s32 MAX_ENTRIES = SLOT_NUM / 2;
+
+    void reset() {
+        mCount = 0;
+        if (++mEpoch != 0) return;
+
+        // Epoch wrapped around, stale stamps could alias the new one
+        for (u32& e : mEpochs) e = 0;
+        mEpoch = 1;
+    }
+
+    bool contains(const al::LiveActor* actor) const {
+        for (u32 slot = calcSlot(actor);; slot = (slot + 1) & (SLOT_NUM - 1)) {
+            if (mEpochs[slot] != mEpoch) return false;
+            if (mActors[slot] == actor) return true;
+        }
+    }
+
+    // Returns false when the set is full; the actor simply stays hittable.
+    bool insert(const al::LiveActor* actor) {
+        u32 slot = calcSlot(actor);
+        for (; mEpochs[slot] == mEpoch; slot = (slot + 1) & (SLOT_NUM - 1))
+            if (mActors[slot] == actor) return true;
+
+        if (mCount >= MAX_ENTRIES) return false;
+
+        mActors[slot] = actor;
+        mEpochs[slot] = mEpoch;
+        mCount++;
+        return true;
+    }
+
+    s32 getCount() const { return mCount; }
+    u32 getEpoch() const { return mEpoch; }  // changes on every reset()
+    bool isFull() const  { return mCount >= MAX_ENTRIES; }
+
+private:
+    friend struct ActorHitSetTest;  // moves the epoch up to the wrap
+
+    static u32 calcSlot(const al::LiveActor* actor) {
+        u64 key = reinterpret_cast<uintptr_t>(actor) >> 4;
+        return (u32)((key * 0x9E3779B97F4A7C15ull) >> 55) & (SLOT_NUM - 1);
+    }
+
+    const al::LiveActor* mActors[SLOT_NUM] = {};
+    u32 mEpochs[SLOT_NUM] = {};
+    u32 mEpoch = 1;
+    s32 mCount = 0;
+};
@@ -1,6 +1,12 @@
 #pragma once
 #include "Player/PlayerConst.h"
 
+// One overridden PlayerConst field, applied by PlayerConstOverride
+struct PlayerConstDelta {
+  f32 PlayerConst::* field;
+  f32 value;
+};
+
 inline void applyNormalMarioConst(PlayerConst* pc) {
   pc->mAdditionalSpeedLimit = 30.00000;
   pc->mAnimFrameRateMaxDash = 4.00000;
@@ -461,48 +467,57 @@ inline void applyNormalMarioConst(PlayerConst* pc) {
   pc->mWallKeepDegree = 60.00000;
 }
 
-inline void applyMoonMarioConst(PlayerConst* pc) {
-  pc->mAnimFrameRateMaxDash = 3.50000;
-  pc->mAnimFrameRateMaxDashFast = 4.50000;
-  pc->mAnimFrameRateMaxRun = 3.00000;
-  pc->mCapCatchPopGravity = 0.60000;
-  pc->mCapHeadSpringJumpGravity = 0.80000;
-  pc->mCapHeadSpringJumpGravityHigh = 0.60000;
-  pc->mCapLeapFrogJumpGravity = 0.40000;
-  pc->mCapLeapFrogJumpPower = 30.00000;
-  pc->mCapLeapFrogJumpPowerAir = 25.00000;
-  pc->mCenterTiltRateMax = 1.00000;
-  pc->mGrabCeilLeavePopGravity = 0.60000;
-  pc->mGravityAir = 1.00000;
-  pc->mGravityDamage = 0.70000;
-  pc->mGravityWallSlide = 0.20000;
-  pc->mHeadSlidingGravityAir = 0.80000;
-  pc->mHeadSlidingJump = 17.00000;
-  pc->mHeadSlidingSpeed = 18.00000;
-  pc->mHipDropGravity = 1.50000;
-  pc->mHipDropSpeed = 0.00000;
-  pc->mJumpGravity = 0.40000;
-  pc->mJumpGravity2nd = 0.40000;
-  pc->mJumpGravity3rd = 0.30000;
-  pc->mJumpGravityCapCatch = 0.60000;
-  pc->mJumpGravityForceRun = 0.35000;
-  pc->mJumpHipDropPower = 32.00000;
-  pc->mJumpPowerMax2DArea = 24.00000;
-  pc->mJumpPowerMin2DArea = 20.50000;
-  pc->mLongJumpGravity = 0.20000;
-  pc->mSpinFlowerJumpDownFallInitSpeed = 0.00000;
-  pc->mSpinFlowerJumpDownFallPower = 1.50000;
-  pc->mSpinJumpDownFallInitSpeed = 0.00000;
-  pc->mSpinJumpGravity = 0.18000;
-  pc->mSquatJumpGravity = 0.45000;
-  pc->mTrampleGravity = 0.50000;
-  pc->mTrampleGravity2D = 0.50000;
-  pc->mTrampleHighGravity = 0.40000;
-  pc->mTrampleHighGravity2D = 0.40000;
-  pc->mTrampleHighJumpPower2D = 27.00000;
-  pc->mTrampleHipDropGravity = 0.40000;
-  pc->mTrampleHipDropJumpPower = 30.00000;
-  pc->mTurnJumpGravity = 0.45000;
-  pc->mWallClimbJumpGravity = 0.80000;
-  pc->mWallJumpGravity = 0.30000;
-}
\ No newline at end of file
+inline constexpr PlayerConstDelta moonMarioConst[] = {
+  { &PlayerConst::mAnimFrameRateMaxDash,            3.50000f },
+  { &PlayerConst::mAnimFrameRateMaxDashFast,        4.50000f },
+  { &PlayerConst::mAnimFrameRateMaxRun,             3.00000f },
+  { &PlayerConst::mCapCatchPopGravity,              0.60000f },
+  { &PlayerConst::mCapHeadSpringJumpGravity,        0.80000f },
+  { &PlayerConst::mCapHeadSpringJumpGravityHigh,    0.60000f },
+  { &PlayerConst::mCapLeapFrogJumpGravity,          0.40000f },
+  { &PlayerConst::mCapLeapFrogJumpPower,            30.00000f },
+  { &PlayerConst::mCapLeapFrogJumpPowerAir,         25.00000f },
+  { &PlayerConst::mCenterTiltRateMax,               1.00000f },
+  { &PlayerConst::mGrabCeilLeavePopGravity,         0.60000f },
+  { &PlayerConst::mGravityAir,                      1.00000f },
+  { &PlayerConst::mGravityDamage,                   0.70000f },
+  { &PlayerConst::mGravityWallSlide,                0.20000f },
+  { &PlayerConst::mHeadSlidingGravityAir,           0.80000f },
+  { &PlayerConst::mHeadSlidingJump,                 17.00000f },
+  { &PlayerConst::mHeadSlidingSpeed,                18.00000f },
+  { &PlayerConst::mHipDropGravity,                  1.50000f },
+  { &PlayerConst::mHipDropSpeed,                    0.00000f },
+  { &PlayerConst::mJumpGravity,                     0.40000f },
+  { &PlayerConst::mJumpGravity2nd,                  0.40000f },
+  { &PlayerConst::mJumpGravity3rd,                  0.30000f },
+  { &PlayerConst::mJumpGravityCapCatch,             0.60000f },
+  { &PlayerConst::mJumpGravityForceRun,             0.35000f },
+  { &PlayerConst::mJumpHipDropPower,                32.00000f },
+  { &PlayerConst::mJumpPowerMax2DArea,              24.00000f },
+  { &PlayerConst::mJumpPowerMin2DArea,              20.50000f },
+  { &PlayerConst::mLongJumpGravity,                 0.20000f },
+  { &PlayerConst::mSpinFlowerJumpDownFallInitSpeed, 0.00000f },
+  { &PlayerConst::mSpinFlowerJumpDownFallPower,     1.50000f },
+  { &PlayerConst::mSpinJumpDownFallInitSpeed,       0.00000f },
+  { &PlayerConst::mSpinJumpGravity,                 0.18000f },
+  { &PlayerConst::mSquatJumpGravity,                0.45000f },
+  { &PlayerConst::mTrampleGravity,                  0.50000f },
+  { &PlayerConst::mTrampleGravity2D,                0.50000f },
+  { &PlayerConst::mTrampleHighGravity,              0.40000f },
+  { &PlayerConst::mTrampleHighGravity2D,            0.40000f },
+  { &PlayerConst::mTrampleHighJumpPower2D,          27.00000f },
+  { &PlayerConst::mTrampleHipDropGravity,           0.40000f },
+  { &PlayerConst::mTrampleHipDropJumpPower,         30.00000f },
+  { &PlayerConst::mTurnJumpGravity,                 0.45000f },
+  { &PlayerConst::mWallClimbJumpGravity,            0.80000f },
+  { &PlayerConst::mWallJumpGravity,                 0.30000f },
+};
+
+// Dash raises the ground speed cap; Super dashes faster
+inline constexpr PlayerConstDelta dashConst[] = {
+  { &PlayerConst::mNormalMaxSpeed, 21.00000f },
+};
+
+inline constexpr PlayerConstDelta dashSuperConst[] = {
+  { &PlayerConst::mNormalMaxSpeed, 28.00000f },
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include <basis/seadTypes.h>
+
+namespace al {
+class LiveActor;
+}
+
+// Maps frozen actors to their slot in the frozen list. Queried from the
+// movement of every actor in the scene, so a miss has to be cheap: an
+// empty index and a 64-bit bloom word reject most actors before probing.
+template <s32 Capacity>
+class FrozenIndex {
+    static constexpr s32 calcSlotNum() {
+        s32 num = 1;
+        while (num < Capacity * 2) num <<= 1;
+        return num;
+    }
+
+public:
+    static constexpr s32 SLOT_NUM    = calcSlotNum();
+    static constexpr s32 SLOT_BITS   = __builtin_ctz(SLOT_NUM);
+    static constexpr s32 MAX_ENTRIES = Capacity;
+
+    // Slot in the frozen list, or -1
+    s32 find(const al::LiveActor* actor) const {
+        if (!mCount) return -1;
+
+        const u64 hash = calcHash(actor);
+        if ((mBloom & calcBloomBits(hash)) != calcBloomBits(hash)) return -1;
+
+        for (u32 slot = calcSlot(hash); mActors[slot]; slot = (slot + 1) & (SLOT_NUM - 1))
+            if (mActors[slot] == actor) return mIndices[slot];
+        return -1;
+    }
+
+    bool insert(const al::LiveActor* actor, s32 index) {
+        const u64 hash = calcHash(actor);
+        u32 slot = calcSlot(hash);
+        for (; mActors[slot]; slot = (slot + 1) & (SLOT_NUM - 1)) {
+            if (mActors[slot] == actor) { mIndices[slot] = index; return true; }
+        }
+        if (mCount >= MAX_ENTRIES) return false;
+
+        mActors[slot] = actor;
+        mIndices[slot] = index;
+        mBloom |= calcBloomBits(hash);
+        mCount++;
+        return true;
+    }
+
+    void erase(const al::LiveActor* actor) {
+        s32 found = findSlot(actor);
+        if (found < 0) return;
+
+        // Shift later entries of the probe run back so lookups never stop early
+        u32 hole = found;
+        for (u32 next = (hole + 1) & (SLOT_NUM - 1); mActors[next]; next = (next + 1) & (SLOT_NUM - 1)) {
+            const u32 home = calcSlot(calcHash(mActors[next]));
+            if (((next - home) & (SLOT_NUM - 1)) < ((next - hole) & (SLOT_NUM - 1))) continue;
+
+            mActors[hole] = mActors[next];
+            mIndices[hole] = mIndices[next];
+            hole = next;
+        }
+        mActors[hole] = nullptr;
+        mCount--;
+
+        // Bloom bits can't be cleared one by one
+        mBloom = 0;
+        for (const al::LiveActor* other : mActors)
+            if (other) mBloom |= calcBloomBits(calcHash(other));
+    }
+
+    void clear() {
+        for (const al::LiveActor*& actor : mActors) actor = nullptr;
+        mBloom = 0;
+        mCount = 0;
+    }
+
+    s32 getCount() const { return mCount; }
+
+private:
+    static u64 calcHash(const al::LiveActor* actor) {
+        return (reinterpret_cast<uintptr_t>(actor) >> 4) * 0x9E3779B97F4A7C15ull;
+    }
+
+    static u32 calcSlot(u64 hash) { return (u32)(hash >> (64 - SLOT_BITS)); }
+
+    static u64 calcBloomBits(u64 hash) { return (1ull << ((hash >> 40) & 63)) | (1ull << ((hash >> 34) & 63)); }
+
+    s32 findSlot(const al::LiveActor* actor) const {
+        for (u32 slot = calcSlot(calcHash(actor)); mActors[slot]; slot = (slot + 1) & (SLOT_NUM - 1))
+            if (mActors[slot] == actor) return slot;
+        return -1;
+    }
+
+    const al::LiveActor* mActors[SLOT_NUM] = {};
+    s32 mIndices[SLOT_NUM] = {};
+    u64 mBloom = 0;
+    s32 mCount = 0;
+};
@@ -0,0 +1,84 @@
+#pragma once
+#include <basis/seadTypes.h>
+
+// Frames and ticks from a pad press to each stage of the action it
+// starts. A press opens a trace on its channel; every stage records its
+// delta the first time it is reached, and the last stage closes the
+// trace. A new press before that drops the open trace.
+class LatencyTracer {
+public:
+    enum Channel : u8 {
+        Spin,
+        Fireball,
+        ChannelNum,
+    };
+
+    enum Stage : u8 {
+        Accept,     // input taken by a try-spin or squat/roll/glide hook
+        Appear,     // PlayerStateSpinCap::appear
+        FirstStep,  // first step of a GalaxySpin nerve
+        Hitbox,     // an attack sensor of the spin is valid
+        Shoot,      // projectile shot
+        StageNum,
+    };
+
+    static constexpr s32 BUCKET_NUM = 16;  // one per frame, the last one is 15 and more
+
+    struct Histogram {
+        u32 count = 0;
+        u32 buckets[BUCKET_NUM] = {};
+        u32 frameSum = 0;
+        u64 tickSum = 0;
+        u64 tickMax = 0;
+    };
+
+    void beginFrame() { mFrame++; }
+
+    void press(Channel channel, u64 tick) {
+        if (mTraces[channel].isOpen) mDropped++;
+        mTraces[channel] = { mFrame, tick, 0, true };
+    }
+
+    void tag(Channel channel, Stage stage, u64 tick) {
+        Trace& trace = mTraces[channel];
+        if (!trace.isOpen || (trace.seen & (1 << stage))) return;
+        trace.seen |= 1 << stage;
+
+        const u32 frames = mFrame - trace.frame;
+        const u64 ticks = tick - trace.tick;
+
+        Histogram& hist = mHists[channel][stage];
+        hist.count++;
+        hist.buckets[frames < BUCKET_NUM ? frames : BUCKET_NUM - 1]++;
+        hist.frameSum += frames;
+        hist.tickSum += ticks;
+        if (ticks > hist.tickMax) hist.tickMax = ticks;
+    }
+
+    void end(Channel channel, Stage stage, u64 tick) {
+        tag(channel, stage, tick);
+        mTraces[channel].isOpen = false;
+    }
+
+    bool isOpen(Channel channel) const { return mTraces[channel].isOpen; }
+    bool hasReached(Channel channel, Stage stage) const {
+        return mTraces[channel].isOpen && (mTraces[channel].seen & (1 << stage));
+    }
+    const Histogram& getHistogram(Channel channel, Stage stage) const { return mHists[channel][stage]; }
+    u32 getDropped() const { return mDropped; }
+
+    void clear() { *this = {}; }
+
+private:
+    struct Trace {
+        u32 frame = 0;
+        u64 tick = 0;
+        u32 seen = 0;  // stages already recorded
+        bool isOpen = false;
+    };
+
+    Trace mTraces[ChannelNum] = {};
+    Histogram mHists[ChannelNum][StageNum] = {};
+    u32 mFrame = 0;
+    u32 mDropped = 0;
+};
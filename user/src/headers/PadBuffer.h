@@ -0,0 +1,56 @@
+#pragma once
+#include "headers/PadSnapshot.h"
+
+// Pad presses of the last frames, one ring per port. Presses are taken
+// from the frame's snapshot, so a press that lands a frame or two before
+// a hook can act on it is still seen. A hook that acts on a press
+// consumes it, so one press drives one action.
+class PadBuffer {
+public:
+    static constexpr s32 HISTORY = 32;  // frames kept, power of two
+    static constexpr s32 PORT_NUM = PadSnapshot::PORT_NUM;
+
+    static_assert((HISTORY & (HISTORY - 1)) == 0, "HISTORY must be a power of two");
+
+    // Once per frame, after the snapshot was captured
+    void update(const PadSnapshot& snapshot) {
+        mHead = (mHead + 1) & (HISTORY - 1);
+        for (s32 slot = 0; slot < PORT_NUM; slot++) mRings[slot][mHead] = snapshot.getTrigger(slot - 1);
+    }
+
+    // Any of buttons pressed within the last frames (this one included)
+    bool isTriggered(s32 port, u16 buttons, s32 frames) const {
+        const s32 slot = port + 1;
+        if (slot < 0 || slot >= PORT_NUM) return false;
+
+        for (s32 i = 0; i < clampFrames(frames); i++)
+            if (mRings[slot][(mHead - i) & (HISTORY - 1)] & buttons) return true;
+        return false;
+    }
+
+    // Drops the buttons from the window so the press can't fire again
+    void consume(s32 port, u16 buttons, s32 frames) {
+        const s32 slot = port + 1;
+        if (slot < 0 || slot >= PORT_NUM) return;
+
+        for (s32 i = 0; i < clampFrames(frames); i++) mRings[slot][(mHead - i) & (HISTORY - 1)] &= ~buttons;
+    }
+
+    bool tryConsume(s32 port, u16 buttons, s32 frames) {
+        if (!isTriggered(port, buttons, frames)) return false;
+        consume(port, buttons, frames);
+        return true;
+    }
+
+    // Forgets old presses, e.g. for a new scene
+    void clear() {
+        for (auto& ring : mRings)
+            for (u16& triggers : ring) triggers = 0;
+    }
+
+private:
+    static s32 clampFrames(s32 frames) { return frames < 1 ? 1 : frames > HISTORY ? HISTORY : frames; }
+
+    u16 mRings[PORT_NUM][HISTORY] = {};
+    s32 mHead = 0;
+};
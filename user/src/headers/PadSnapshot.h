@@ -0,0 +1,113 @@
+#pragma once
+#include <basis/seadTypes.h>
+#include "Library/Controller/InputFunction.h"
+
+// Trigger, hold and release bits of every button the mod reads, taken
+// from the controller library once per frame. Release is derived from
+// the previous hold. The main port (-1) is always read; other ports from
+// the first time they are asked about.
+class PadSnapshot {
+public:
+    enum Button : u16 {
+        A     = 1 << 0,
+        B     = 1 << 1,
+        X     = 1 << 2,
+        Y     = 1 << 3,
+        L     = 1 << 4,
+        R     = 1 << 5,
+        ZL    = 1 << 6,
+        ZR    = 1 << 7,
+        Left  = 1 << 8,
+        Right = 1 << 9,
+        Up    = 1 << 10,
+        Down  = 1 << 11,
+        Spin  = 1 << 15,  // whichever button the config picked for GalaxySpin
+    };
+
+    static constexpr s32 PORT_NUM = 5;  // the main port (-1) and ports 0-3
+
+    // Button named in the config file; anything but L or X is Y
+    static constexpr u16 toButton(char name) {
+        switch (name) {
+            case 'L': return L;
+            case 'X': return X;
+            case 'Y': default: return Y;
+        }
+    }
+
+    // Top of the frame. spinButton is the button Spin stands for.
+    void capture(u16 spinButton) {
+        mSpinButton = spinButton;
+        for (s32 slot = 0; slot < PORT_NUM; slot++)
+            if (mUsedPorts & (1 << slot)) read(slot);
+    }
+
+    // Starts reading a port; the current frame is read right away
+    void use(s32 port) {
+        const s32 slot = port + 1;
+        if (slot < 0 || slot >= PORT_NUM || (mUsedPorts & (1 << slot))) return;
+
+        mUsedPorts |= 1 << slot;
+        read(slot);
+    }
+
+    // Drops the edges of the last capture, e.g. when no new one is coming
+    void expire() {
+        for (State& state : mStates) state.trigger = state.release = 0;
+    }
+
+    u16 getTrigger(s32 port) const { return isValidPort(port) ? mStates[port + 1].trigger : 0; }
+    u16 getHold(s32 port) const { return isValidPort(port) ? mStates[port + 1].hold : 0; }
+    u16 getRelease(s32 port) const { return isValidPort(port) ? mStates[port + 1].release : 0; }
+    u16 getSpinButton() const { return mSpinButton; }
+
+private:
+    struct State {
+        u16 trigger = 0;
+        u16 hold = 0;
+        u16 release = 0;
+    };
+
+    struct Reader {
+        u16 button;
+        bool (*isTrigger)(s32);
+        bool (*isHold)(s32);
+    };
+
+    static constexpr Reader readers[] = {
+        { A,     al::isPadTriggerA,     al::isPadHoldA },
+        { B,     al::isPadTriggerB,     al::isPadHoldB },
+        { X,     al::isPadTriggerX,     al::isPadHoldX },
+        { Y,     al::isPadTriggerY,     al::isPadHoldY },
+        { L,     al::isPadTriggerL,     al::isPadHoldL },
+        { R,     al::isPadTriggerR,     al::isPadHoldR },
+        { ZL,    al::isPadTriggerZL,    al::isPadHoldZL },
+        { ZR,    al::isPadTriggerZR,    al::isPadHoldZR },
+        { Left,  al::isPadTriggerLeft,  al::isPadHoldLeft },
+        { Right, al::isPadTriggerRight, al::isPadHoldRight },
+        { Up,    al::isPadTriggerUp,    al::isPadHoldUp },
+        { Down,  al::isPadTriggerDown,  al::isPadHoldDown },
+    };
+
+    static bool isValidPort(s32 port) { return port >= -1 && port < PORT_NUM - 1; }
+
+    void read(s32 slot) {
+        const s32 port = slot - 1;
+        State& state = mStates[slot];
+        const u16 prevHold = state.hold;
+        state = {};
+
+        for (const Reader& reader : readers) {
+            if (reader.isTrigger(port)) state.trigger |= reader.button;
+            if (reader.isHold(port)) state.hold |= reader.button;
+        }
+
+        if (state.trigger & mSpinButton) state.trigger |= Spin;
+        if (state.hold & mSpinButton) state.hold |= Spin;
+        state.release = prevHold & ~state.hold;
+    }
+
+    State mStates[PORT_NUM] = {};
+    u8 mUsedPorts = 1;  // main port
+    u16 mSpinButton = Y;
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include "headers/CustomPlayerConst.h"
+
+// Layers of PlayerConst overrides on top of the values the game loaded.
+// Fields are snapshotted the first time a layer touches them. Changing
+// a layer restores the snapshot and reapplies every active layer, so
+// nothing is written while the mode stays the same.
+class PlayerConstOverride {
+public:
+    enum Layer : u8 {
+        Suit,
+        Dash,
+        LayerNum,
+    };
+
+    static constexpr s32 SNAPSHOT_MAX = 64;
+
+    // Starts over on pc. From initPlayer: a reloaded PlayerConst can sit at
+    // the same address, so the old snapshot is dropped either way.
+    void init(PlayerConst* pc) {
+        *this = {};
+        mConst = pc;
+    }
+
+    // Per frame: starts over only when the game hands the player a different PlayerConst
+    void follow(PlayerConst* pc) {
+        if (pc != mConst) init(pc);
+    }
+
+    void set(Layer layer, const PlayerConstDelta* deltas, s32 count) {
+        if (mLayers[layer].deltas == deltas) return;
+
+        mLayers[layer] = { deltas, count };
+        apply();
+    }
+
+    template <s32 N>
+    void set(Layer layer, const PlayerConstDelta (&deltas)[N]) { set(layer, deltas, N); }
+
+    void clear(Layer layer) { set(layer, nullptr, 0); }
+
+    // Puts back every field a layer changed
+    void restore() {
+        if (!mConst) return;
+        for (s32 i = 0; i < mSnapshotCount; i++) mConst->*mSnapshot[i].field = mSnapshot[i].value;
+    }
+
+private:
+    struct Entry {
+        const PlayerConstDelta* deltas = nullptr;
+        s32 count = 0;
+    };
+
+    // False when the snapshot is full and the field must stay untouched
+    bool snapshot(f32 PlayerConst::* field) {
+        for (s32 i = 0; i < mSnapshotCount; i++)
+            if (mSnapshot[i].field == field) return true;
+
+        if (mSnapshotCount >= SNAPSHOT_MAX) return false;
+        mSnapshot[mSnapshotCount++] = { field, mConst->*field };
+        return true;
+    }
+
+    void apply() {
+        if (!mConst) return;
+        restore();
+
+        for (const Entry& entry : mLayers) {
+            for (s32 i = 0; i < entry.count; i++) {
+                const PlayerConstDelta& delta = entry.deltas[i];
+                if (snapshot(delta.field)) mConst->*delta.field = delta.value;
+            }
+        }
+    }
+
+    PlayerConst* mConst = nullptr;
+    Entry mLayers[LayerNum] = {};
+    PlayerConstDelta mSnapshot[SNAPSHOT_MAX] = {};
+    s32 mSnapshotCount = 0;
+};
@@ -0,0 +1,53 @@
+#pragma once
+#include "Library/LiveActor/ActorModelFunction.h"
+#include "Library/LiveActor/LiveActorFunction.h"
+#include "Library/LiveActor/ActorPoseUtil.h"
+
+// Sub-actors and joints of the player model, resolved once in initPlayer.
+// Costumes that lack a part leave it null (or the joint at -1) and callers skip it.
+struct PlayerParts {
+    enum Joint : u8 {
+        ArmL2,
+        ArmR2,
+        HandL,
+        HandR,
+        JointNum,
+    };
+
+    al::LiveActor* model  = nullptr;  // "Normal"
+    al::LiveActor* cape   = nullptr;  // "ケープ"
+    al::LiveActor* tail   = nullptr;  // "尻尾"
+    al::LiveActor* face   = nullptr;  // "顔"
+    al::LiveActor* hammer = nullptr;  // "Hammer", the one on the model
+    s32 joints[JointNum] = { -1, -1, -1, -1 };
+
+    void init(al::LiveActor* normal) {
+        static constexpr const char* jointNames[JointNum] = { "ArmL2", "ArmR2", "HandL", "HandR" };
+
+        *this = {};
+        model = normal;
+        if (!model) return;
+
+        cape   = al::tryGetSubActor(model, "ケープ");
+        tail   = al::tryGetSubActor(model, "尻尾");
+        face   = al::tryGetSubActor(model, "顔");
+        hammer = al::tryGetSubActor(model, "Hammer");
+        for (s32 i = 0; i < JointNum; i++) joints[i] = al::getJointIndex(model, jointNames[i]);
+    }
+
+    const sead::Matrix34f* getJointMtx(Joint joint) const {
+        if (!model || joints[joint] < 0) return nullptr;
+        return al::getJointMtxPtrByIndex(model, joints[joint]);
+    }
+
+    // Falls back to the model origin when the joint is missing. Without a
+    // model pos is left as it is and false is returned.
+    bool calcJointPos(sead::Vector3f* pos, Joint joint) const {
+        if (!model) return false;
+
+        const sead::Matrix34f* mtx = getJointMtx(joint);
+        if (mtx) mtx->getTranslation(*pos);
+        else *pos = al::getTrans(model);
+        return true;
+    }
+};
@@ -0,0 +1,42 @@
+#pragma once
+#include "Library/LiveActor/ActorSensorUtil.h"
+#include "Project/HitSensor/HitSensor.h"
+
+// Hit sensors the mod toggles or compares against, resolved once in initPlayer.
+// A sensor missing from the model stays null and the helpers skip it.
+struct PlayerSensors {
+    al::HitSensor* galaxySpin   = nullptr;
+    al::HitSensor* doubleSpin   = nullptr;
+    al::HitSensor* punch        = nullptr;
+    al::HitSensor* hipDrop      = nullptr;  // "HipDropKnockDown"
+    al::HitSensor* carry        = nullptr;
+    al::HitSensor* foot         = nullptr;
+    al::HitSensor* body         = nullptr;
+    al::HitSensor* head         = nullptr;
+    al::HitSensor* hammerAttack = nullptr;  // "AttackHack" on the player hammer
+
+    void init(al::LiveActor* player, al::LiveActor* hammer) {
+        galaxySpin   = al::getHitSensor(player, "GalaxySpin");
+        doubleSpin   = al::getHitSensor(player, "DoubleSpin");
+        punch        = al::getHitSensor(player, "Punch");
+        hipDrop      = al::getHitSensor(player, "HipDropKnockDown");
+        carry        = al::getHitSensor(player, "Carry");
+        foot         = al::getHitSensor(player, "Foot");
+        body         = al::getHitSensor(player, "Body");
+        head         = al::getHitSensor(player, "Head");
+        hammerAttack = hammer ? al::getHitSensor(hammer, "AttackHack") : nullptr;
+    }
+
+    bool isAttack(const al::HitSensor* sensor) const {
+        return sensor && (sensor == galaxySpin || sensor == doubleSpin || sensor == punch || sensor == hipDrop);
+    }
+
+    static bool isValid(const al::HitSensor* sensor) { return sensor && sensor->mIsValid; }
+
+    static void validate(al::HitSensor* sensor)   { if (sensor) sensor->validate(); }
+    static void invalidate(al::HitSensor* sensor) { if (sensor) sensor->invalidate(); }
+
+    // Punch windup makes the player untouchable
+    void validateBody()   { validate(foot); validate(body); validate(head); }
+    void invalidateBody() { invalidate(foot); invalidate(body); invalidate(head); }
+};
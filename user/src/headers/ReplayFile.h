@@ -0,0 +1,52 @@
+#pragma once
+#include <basis/seadTypes.h>
+
+// On-disk layout of an input replay: a header followed by one frame
+// record per player frame, little endian. replay_diff.js reads the same
+// layout, so both change together (bump VERSION).
+struct ReplayHeader {
+    static constexpr u32 MAGIC = 0x50525347;  // "GSRP"
+    static constexpr u16 VERSION = 1;
+
+    u32 magic = MAGIC;
+    u16 version = VERSION;
+    u16 frameSize = 0;
+    u32 seed = 0;
+    u32 frameNum = 0;  // written when the take ends; 0 until then, count from the file size
+
+    bool isValid(u16 expectedFrameSize) const {
+        return magic == MAGIC && version == VERSION && frameSize == expectedFrameSize;
+    }
+};
+
+struct ReplayFrame {
+    static constexpr f32 STICK_SCALE = 32767.0f;
+
+    u16 trigger = 0;    // PadSnapshot buttons of port -1
+    u16 hold = 0;
+    s16 sticks[4] = {};  // left x/y, right x/y
+    u32 hash = 0;       // player state after the frame
+    u32 ticks = 0;      // system ticks spent in the player's movement
+
+    static s16 toStick(f32 value) {
+        if (value > 1.0f) value = 1.0f;
+        if (value < -1.0f) value = -1.0f;
+        return (s16)(value * STICK_SCALE + (value < 0.0f ? -0.5f : 0.5f));
+    }
+
+    static f32 fromStick(s16 value) { return value / STICK_SCALE; }
+};
+
+static_assert(sizeof(ReplayHeader) == 16, "ReplayHeader layout is read by replay_diff.js");
+static_assert(sizeof(ReplayFrame) == 20, "ReplayFrame layout is read by replay_diff.js");
+
+// FNV-1a over the raw bytes of each value added
+struct ReplayHash {
+    u32 value = 2166136261u;
+
+    template <typename T>
+    void add(const T& data) {
+        const u8* bytes = reinterpret_cast<const u8*>(&data);
+        for (u32 i = 0; i < sizeof(T); i++) value = (value ^ bytes[i]) * 16777619u;
+    }
+};
@@ -0,0 +1,154 @@
+#pragma once
+#include <basis/seadTypes.h>
+
+// Tracks the spins of one spin sequence (from the first throw until the
+// player lands or throws again from a non-spin state). Hooks report what
+// happened as events and read what is allowed back from the state;
+// every change of state is one lookup in the transition table.
+class SpinController {
+public:
+    // The state is a set of these flags
+    enum Flag : u8 {
+        IsGalaxy       = 1 << 0,  // GalaxySpin running
+        CanGalaxy      = 1 << 1,  // the sequence still has its GalaxySpin
+        CanStandard    = 1 << 2,  // the sequence still has its standard spin
+        GalaxyQueued   = 1 << 3,  // GalaxySpin thrown out of a standard spin
+        StandardQueued = 1 << 4,  // standard spin thrown out of a GalaxySpin
+        IsRequested    = 1 << 5,  // next spin is a GalaxySpin
+    };
+
+    using State = u8;
+
+    enum class Event : u8 {
+        Reset,            // fresh throw from outside the spin state
+        RequestGalaxy,    // GalaxySpin input taken
+        CancelRequest,    // the game started its own throw instead
+        RethrowGalaxy,    // GalaxySpin input during a standard spin
+        RethrowStandard,  // standard input during a GalaxySpin
+        Appear,           // PlayerStateSpinCap::appear
+        SwimStart,        // first step of a swim spin
+        End,              // GalaxySpin is over
+        Num,
+    };
+
+    // Fake GalaxySpin: the input was taken but no spin is left
+    enum class Fake : u8 { None, Requested, Active };
+
+    static constexpr s32 STATE_NUM = 1 << 6;
+    static constexpr s32 EVENT_NUM = (s32)Event::Num;
+    static constexpr State INITIAL = CanGalaxy | CanStandard;
+
+    // What an event does to the flags. Only used to build the table.
+    static constexpr State apply(State state, Event event) {
+        u32 flags = state;
+        switch (event) {
+            case Event::Reset:           return (State)((flags | CanGalaxy | CanStandard) & ~(GalaxyQueued | StandardQueued));
+            case Event::RequestGalaxy:   return (State)(flags | IsRequested);
+            case Event::CancelRequest:   return (State)(flags & ~IsRequested);
+            case Event::RethrowGalaxy:   return (State)(flags | GalaxyQueued);
+            case Event::RethrowStandard: return (State)(flags | StandardQueued);
+            case Event::Appear:
+                // A queued GalaxySpin uses up the standard spin, a queued
+                // standard spin the GalaxySpin
+                if (flags & GalaxyQueued) flags = (flags & ~(GalaxyQueued | CanStandard)) | IsRequested;
+                if (flags & StandardQueued) flags &= ~(StandardQueued | CanGalaxy | IsRequested);
+                if (flags & IsRequested) return (State)((flags | IsGalaxy) & ~(CanGalaxy | IsRequested));
+                return (State)(flags & ~(CanStandard | IsGalaxy));
+            case Event::SwimStart:       return (State)((flags | IsGalaxy) & ~IsRequested);  // swim spins don't use it up
+            case Event::End:             return (State)(flags & ~IsGalaxy);
+            default:                     return state;
+        }
+    }
+
+    struct Table {
+        State next[STATE_NUM][EVENT_NUM];
+    };
+
+    static constexpr Table buildTable() {
+        Table table = {};
+        for (s32 state = 0; state < STATE_NUM; state++)
+            for (s32 event = 0; event < EVENT_NUM; event++)
+                table.next[state][event] = apply((State)state, (Event)event);
+        return table;
+    }
+
+    // Row per state, column per event
+    static const Table transitions;
+
+    static State next(State state, Event event) { return transitions.next[state][(s32)event]; }
+    static constexpr bool has(State state, Flag flag) { return state & flag; }
+
+    void send(Event event) { mState = next(mState, event); }
+
+    // Takes GalaxySpin input; a fake one follows when none is left.
+    // Returns false for the fake one.
+    bool requestGalaxy() {
+        const bool isAllowed = canGalaxy();
+        send(Event::RequestGalaxy);
+        if (!isAllowed) requestFake();
+        return isAllowed;
+    }
+
+    void requestFake() { mFake = Fake::Requested; }
+
+    // Once per frame. True when the spin sensors just ran out.
+    bool tick() {
+        if (mSensorFrames < 0 || --mSensorFrames > 0) return false;
+
+        mSensorFrames = -1;
+        send(Event::End);
+        return true;
+    }
+
+    // Once per update of the spin cap state. True when the fake ran out.
+    bool tickFake() {
+        if (mFake != Fake::Active) return false;
+        if (mFakeFrames > 0) { mFakeFrames--; return false; }
+
+        mFake = Fake::None;
+        return true;
+    }
+
+    void startSensor(s32 frames) { mSensorFrames = frames; }
+
+    void startFake(s32 frames) {
+        mFake = Fake::Active;
+        mFakeFrames = frames;
+        startSensor(frames);
+    }
+
+    void clearFake() { mFake = Fake::None; }
+
+    // Spin nerves set this while they run
+    void setActive(bool isActive) { mIsActive = isActive; }
+
+    // Called around the game's own try-spin during a spin
+    void setRethrow(bool isRethrow) { mIsRethrow = isRethrow; }
+
+    void clear() { *this = {}; }
+
+    State getState() const { return mState; }
+    Fake getFake() const { return mFake; }
+    bool canGalaxy() const { return has(mState, CanGalaxy); }
+    bool canStandard() const { return has(mState, CanStandard); }
+    bool isGalaxy() const { return has(mState, IsGalaxy); }
+    bool isRequested() const { return has(mState, IsRequested); }
+    bool isFake() const { return mFake != Fake::None; }
+    bool isRethrow() const { return mIsRethrow; }
+    bool isActive() const { return mIsActive; }
+
+    // Carried objects can't be thrown until all of the spin is over
+    bool isBusy() const { return mIsActive || mSensorFrames >= 0 || mFake != Fake::None; }
+
+private:
+    friend struct SpinControllerTest;  // starts from any state
+
+    State mState = INITIAL;
+    Fake mFake = Fake::None;
+    s32 mSensorFrames = -1;
+    s32 mFakeFrames = 0;
+    bool mIsActive = false;
+    bool mIsRethrow = false;
+};
+
+inline constexpr SpinController::Table SpinController::transitions = SpinController::buildTable();
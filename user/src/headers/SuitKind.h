@@ -0,0 +1,50 @@
+#pragma once
+#include <basis/seadTypes.h>
+
+// Costume the player was initialised with, resolved once in initPlayer.
+// Per-frame code is instantiated per kind and picked through a function pointer.
+enum class SuitKind : u8 {
+    Other,
+    Mario,
+    Feather,
+    Fire,
+    Ice,
+    Tanooki,
+    Brawl,
+    Super,
+    Num,
+};
+
+// Compile-time suit flags for code templated on SuitKind
+template <SuitKind S>
+struct SuitTraits {
+    static constexpr bool isMario   = S == SuitKind::Mario;
+    static constexpr bool isFeather = S == SuitKind::Feather;
+    static constexpr bool isFire    = S == SuitKind::Fire;
+    static constexpr bool isIce     = S == SuitKind::Ice;
+    static constexpr bool isTanooki = S == SuitKind::Tanooki;
+    static constexpr bool isBrawl   = S == SuitKind::Brawl;
+    static constexpr bool isSuper   = S == SuitKind::Super;
+
+    static constexpr bool isFireball = isMario || isFire || isIce || isBrawl || isSuper;
+    static constexpr bool isCape     = isMario || isBrawl;
+};
+
+constexpr const char* getSuitMoveAnim(SuitKind kind) {
+    switch (kind) {
+        case SuitKind::Super:   return "MoveSuper";
+        case SuitKind::Brawl:   return "MoveBrawl";
+        case SuitKind::Feather:
+        case SuitKind::Tanooki: return "Move";
+        default:                return "MoveClassic";
+    }
+}
+
+// nullptr keeps the game's own name
+constexpr const char* getSuitWearEndAnim(SuitKind kind) {
+    switch (kind) {
+        case SuitKind::Super: return "WearEndSuper";
+        case SuitKind::Brawl: return "WearEndBrawl";
+        default:              return nullptr;
+    }
+}
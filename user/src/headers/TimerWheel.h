@@ -0,0 +1,71 @@
+#pragma once
+#include <basis/seadTypes.h>
+
+// Hashed timer wheel over a fixed set of ids. A timer lives in the bucket
+// of its expiry frame, so tick() only visits one bucket per frame and a
+// long timer is looked at once per revolution.
+template <s32 Capacity, s32 BucketNum = 64>
+class TimerWheel {
+    static_assert((BucketNum & (BucketNum - 1)) == 0, "BucketNum must be a power of two");
+    static_assert(Capacity <= 0x7FFF, "ids are stored as s16");
+
+public:
+    TimerWheel() { clear(); }
+
+    void schedule(s32 id, s32 frames) {
+        cancel(id);
+
+        const u32 expire = mFrame + (frames > 0 ? frames : 1);
+        const s32 bucket = expire & (BucketNum - 1);
+
+        mExpire[id] = expire;
+        mPrev[id] = -1;
+        mNext[id] = mHeads[bucket];
+        if (mHeads[bucket] >= 0) mPrev[mHeads[bucket]] = id;
+        mHeads[bucket] = id;
+        mIsScheduled[id] = true;
+    }
+
+    void cancel(s32 id) {
+        if (!mIsScheduled[id]) return;
+
+        if (mPrev[id] >= 0) mNext[mPrev[id]] = mNext[id];
+        else mHeads[mExpire[id] & (BucketNum - 1)] = mNext[id];
+        if (mNext[id] >= 0) mPrev[mNext[id]] = mPrev[id];
+        mIsScheduled[id] = false;
+    }
+
+    // Advances one frame and hands every expired id to func. func may
+    // cancel or reschedule the id it was given, but no other id.
+    template <typename Func>
+    void tick(Func&& func) {
+        mFrame++;
+
+        s32 id = mHeads[mFrame & (BucketNum - 1)];
+        while (id >= 0) {
+            const s32 next = mNext[id];
+            if ((s32)(mExpire[id] - mFrame) <= 0) {
+                cancel(id);
+                func(id);
+            }
+            id = next;
+        }
+    }
+
+    void clear() {
+        for (s16& head : mHeads) head = -1;
+        for (bool& isScheduled : mIsScheduled) isScheduled = false;
+    }
+
+    bool isScheduled(s32 id) const { return mIsScheduled[id]; }
+    s32 getRemaining(s32 id) const { return mIsScheduled[id] ? (s32)(mExpire[id] - mFrame) : 0; }
+    u32 getFrame() const { return mFrame; }
+
+private:
+    u32 mFrame = 0;
+    s16 mHeads[BucketNum];
+    s16 mNext[Capacity] = {};
+    s16 mPrev[Capacity] = {};
+    u32 mExpire[Capacity] = {};
+    bool mIsScheduled[Capacity] = {};
+};
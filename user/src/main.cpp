@@ -1,14 +1,16 @@
 #include "custom/_Globals.h"
 #include "custom/_Nerves.h"
 #include "custom/AttackSensor.h"
+#include "custom/PadInput.h"
 #include "custom/PlayerCore.h"
 #include "custom/PlayerSpinAttack.h"
 #include "custom/PowerUps.h"
+#include "custom/Replay.h"
 
 struct TriggerCameraReset : public mallow::hook::Trampoline<TriggerCameraReset> {
     static bool Callback(al::LiveActor* actor, int port) {
         if ((isMario || isFire || isIce || isBrawl || isSuper)
-            && al::isPadTriggerR(-1)) return false;
+            && pad::trigger<pad::Button::R>()) return false;
 
         return Orig(actor, port);
     }
@@ -23,6 +25,7 @@ extern "C" void userMain() {
     AttackSensor::Install();
     PowerUps::Install();
     PlayerFreeze::Install();
+    Replay::Install();
 
     TriggerCameraReset::InstallAtSymbol("_ZN19PlayerInputFunction20isTriggerCameraResetEPKN2al9LiveActorEi");
 
@@ -11,6 +11,7 @@ namespace mallow::config {
     const char* defaultConfig = R"(
 {
     "spinButton": "Y",
+    "inputBuffer": 3,
 }
     )";
 
@@ -0,0 +1,67 @@
+#include <chrono>
+#include <cstdio>
+#include "headers/ActorHitSet.h"
+
+namespace al {
+class LiveActor {
+    char mPad[0x100];
+};
+}  // namespace al
+
+// Attack window of the hooks: every contact checks the set, new targets go
+// in, and each target is touched for a few frames before the window resets.
+// The old hitBuffer (a linear array) is timed next to it.
+
+static constexpr s32 CONTACTS_PER_TARGET = 4;
+static constexpr s32 WINDOW_NUM = 20000;
+
+static al::LiveActor actors[ActorHitSet::MAX_ENTRIES];
+
+struct LinearBuffer {
+    const al::LiveActor* actors[ActorHitSet::MAX_ENTRIES];
+    s32 count = 0;
+
+    void reset() { count = 0; }
+
+    bool contains(const al::LiveActor* actor) const {
+        for (s32 i = 0; i < count; i++)
+            if (actors[i] == actor) return true;
+        return false;
+    }
+
+    void insert(const al::LiveActor* actor) { actors[count++] = actor; }
+};
+
+template <typename Set>
+static double runWindows(Set& set, s32 targetNum, u64* hits) {
+    const auto start = std::chrono::steady_clock::now();
+    for (s32 window = 0; window < WINDOW_NUM; window++) {
+        set.reset();
+        for (s32 pass = 0; pass < CONTACTS_PER_TARGET; pass++) {
+            for (s32 i = 0; i < targetNum; i++) {
+                // Spread the targets like a strided actor pool would
+                const al::LiveActor* actor = &actors[(i * 37 + window) % ActorHitSet::MAX_ENTRIES];
+                if (set.contains(actor)) continue;
+                set.insert(actor);
+                (*hits)++;
+            }
+        }
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / ((double)WINDOW_NUM * targetNum * CONTACTS_PER_TARGET);
+}
+
+int main() {
+    static ActorHitSet set;
+    static LinearBuffer linear;
+    u64 hits = 0;
+
+    std::printf("targets  linear ns/contact  hash set ns/contact\n");
+    for (s32 targetNum = 1; targetNum <= ActorHitSet::MAX_ENTRIES; targetNum *= 2) {
+        const double linearNs = runWindows(linear, targetNum, &hits);
+        const double setNs = runWindows(set, targetNum, &hits);
+        std::printf("%7d  %17.2f  %19.2f\n", targetNum, linearNs, setNs);
+    }
+    std::printf("(%llu hits)\n", (unsigned long long)hits);
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "Check.h"
+#include "headers/ActorHitSet.h"
+
+namespace al {
+class LiveActor {
+    char mPad[0x100];
+};
+}  // namespace al
+
+static al::LiveActor actors[ActorHitSet::MAX_ENTRIES + 8];
+
+static int testInsertAndReset() {
+    static ActorHitSet set;
+
+    for (s32 num = 1; num <= ActorHitSet::MAX_ENTRIES; num *= 2) {
+        set.reset();
+        for (s32 i = 0; i < num; i++) CHECK(set.insert(&actors[i]));
+        for (s32 i = 0; i < num; i++) CHECK(set.insert(&actors[i]));  // already in, not counted again
+        CHECK(set.getCount() == num);
+
+        for (s32 i = 0; i < num; i++) CHECK(set.contains(&actors[i]));
+        for (s32 i = num; i < num + 8; i++) CHECK(!set.contains(&actors[i]));
+    }
+
+    set.reset();
+    CHECK(set.getCount() == 0);
+    for (const al::LiveActor& actor : actors) CHECK(!set.contains(&actor));
+    return 0;
+}
+
+static int testFull() {
+    static ActorHitSet set;
+
+    for (s32 i = 0; i < ActorHitSet::MAX_ENTRIES; i++) CHECK(set.insert(&actors[i]));
+    CHECK(set.isFull());
+
+    // New actors are refused, the ones already in still answer
+    for (s32 i = ActorHitSet::MAX_ENTRIES; i < ActorHitSet::MAX_ENTRIES + 8; i++) {
+        CHECK(!set.insert(&actors[i]));
+        CHECK(!set.contains(&actors[i]));
+    }
+    CHECK(set.insert(&actors[0]));
+    CHECK(set.getCount() == ActorHitSet::MAX_ENTRIES);
+    for (s32 i = 0; i < ActorHitSet::MAX_ENTRIES; i++) CHECK(set.contains(&actors[i]));
+
+    set.reset();
+    CHECK(!set.isFull());
+    CHECK(set.insert(&actors[ActorHitSet::MAX_ENTRIES]));
+    return 0;
+}
+
+struct ActorHitSetTest {
+    static void setEpoch(ActorHitSet& set, u32 epoch) { set.mEpoch = epoch; }
+};
+
+static int testEpochWrap() {
+    static ActorHitSet set;
+
+    // Stamps of epoch 1 would alias the first epoch after the wrap
+    for (s32 i = 0; i < 64; i++) CHECK(set.insert(&actors[i]));
+    ActorHitSetTest::setEpoch(set, 0xFFFFFFFF);
+    for (s32 i = 64; i < 96; i++) CHECK(set.insert(&actors[i]));
+    CHECK(!set.contains(&actors[0]));
+
+    set.reset();
+    CHECK(set.getEpoch() == 1);
+    for (const al::LiveActor& actor : actors) CHECK(!set.contains(&actor));
+    CHECK(set.insert(&actors[5]));
+    CHECK(set.contains(&actors[5]));
+    CHECK(!set.contains(&actors[6]));
+    CHECK(set.getCount() == 1);
+    return 0;
+}
+
+int main() {
+    if (testInsertAndReset()) return 1;
+    if (testFull()) return 1;
+    if (testEpochWrap()) return 1;
+    std::printf("ActorHitSet: ok\n");
+    return 0;
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <cstdio>
+
+// Fails the test with the location of the first broken check
+#define CHECK(cond)                                                              \
+    do {                                                                         \
+        if (!(cond)) {                                                           \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                            \
+        }                                                                        \
+    } while (0)
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstdio>
+#include "headers/FrozenIndex.h"
+
+namespace al {
+class LiveActor {
+    char mPad[0x200];
+};
+}  // namespace al
+
+// The movement hook asks about every actor in the scene each frame.
+// 500 actors against 0 to 32 frozen ones, the old linear scan of the
+// frozen list next to FrozenIndex.
+
+static constexpr s32 CAPACITY = 32;
+static constexpr s32 ACTOR_NUM = 500;
+static constexpr s32 FRAME_NUM = 20000;
+
+static al::LiveActor actors[ACTOR_NUM];
+
+template <typename Func>
+static double runFrames(Func&& find, s64* sink) {
+    const auto start = std::chrono::steady_clock::now();
+    for (s32 frame = 0; frame < FRAME_NUM; frame++)
+        for (const al::LiveActor& actor : actors) *sink += find(&actor);
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / ((double)FRAME_NUM * ACTOR_NUM);
+}
+
+int main() {
+    s64 sink = 0;
+
+    std::printf("frozen  linear ns/actor  index ns/actor\n");
+    for (s32 frozenNum : { 0, 1, 4, 8, 16, 32 }) {
+        static FrozenIndex<CAPACITY> index;
+        const al::LiveActor* list[CAPACITY];
+
+        index.clear();
+        for (s32 i = 0; i < frozenNum; i++) {
+            list[i] = &actors[i * 15];
+            index.insert(list[i], i);
+        }
+
+        const double linearNs = runFrames([&](const al::LiveActor* actor) {
+            for (s32 i = 0; i < frozenNum; i++)
+                if (list[i] == actor) return i;
+            return -1;
+        }, &sink);
+        const double indexNs = runFrames([&](const al::LiveActor* actor) { return index.find(actor); }, &sink);
+        std::printf("%6d  %15.2f  %14.2f\n", frozenNum, linearNs, indexNs);
+    }
+    std::printf("(%lld)\n", (long long)sink);
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include "Check.h"
+#include "headers/FrozenIndex.h"
+
+namespace al {
+class LiveActor {
+    char mPad[0x200];
+};
+}  // namespace al
+
+// FROZEN_ACTOR_MAX in ModConfig.h
+static constexpr s32 CAPACITY = 32;
+static constexpr s32 ACTOR_NUM = 500;
+
+static al::LiveActor actors[ACTOR_NUM];
+
+static s32 findLinear(const al::LiveActor* const* list, s32 count, const al::LiveActor* actor) {
+    for (s32 i = 0; i < count; i++)
+        if (list[i] == actor) return i;
+    return -1;
+}
+
+// Random freezes and thaws against a plain list, with the swap-remove the
+// frozen list does on thaw
+static int testAgainstList() {
+    static FrozenIndex<CAPACITY> index;
+    const al::LiveActor* list[CAPACITY];
+    s32 count = 0;
+    u32 seed = 1;
+    auto next = [&seed] { return (seed = seed * 1664525u + 1013904223u) >> 8; };
+
+    for (s32 step = 0; step < 200000; step++) {
+        const al::LiveActor* actor = &actors[next() % ACTOR_NUM];
+        const s32 at = findLinear(list, count, actor);
+
+        if (next() & 1) {
+            if (at < 0) {
+                const bool isInserted = index.insert(actor, count);
+                CHECK(isInserted == (count < CAPACITY));
+                if (isInserted) list[count++] = actor;
+            }
+        } else if (at >= 0) {
+            index.erase(actor);
+            list[at] = list[--count];
+            if (at < count) CHECK(index.insert(list[at], at));  // moved, only updates the slot
+        }
+
+        CHECK(index.getCount() == count);
+        for (s32 i = 0; i < 4; i++) {
+            const al::LiveActor* query = &actors[next() % ACTOR_NUM];
+            CHECK(index.find(query) == findLinear(list, count, query));
+        }
+    }
+
+    index.clear();
+    CHECK(index.getCount() == 0);
+    for (const al::LiveActor& actor : actors) CHECK(index.find(&actor) == -1);
+    return 0;
+}
+
+int main() {
+    if (testAgainstList()) return 1;
+    std::printf("FrozenIndex: ok\n");
+    return 0;
+}
@@ -0,0 +1,163 @@
+#include "Check.h"
+#include "headers/SpinController.h"
+
+using Event = SpinController::Event;
+
+// The spin flags the hooks kept as globals before SpinController, with each
+// event written out the way the hooks used to change them
+struct SpinFlags {
+    bool isGalaxySpin = false;
+    bool canGalaxySpin = true;
+    bool canStandardSpin = true;
+    bool isGalaxyAfterStandardSpin = false;
+    bool isStandardAfterGalaxySpin = false;
+    bool triggerGalaxySpin = false;
+
+    static SpinFlags fromState(SpinController::State state) {
+        SpinFlags flags;
+        flags.isGalaxySpin = state & SpinController::IsGalaxy;
+        flags.canGalaxySpin = state & SpinController::CanGalaxy;
+        flags.canStandardSpin = state & SpinController::CanStandard;
+        flags.isGalaxyAfterStandardSpin = state & SpinController::GalaxyQueued;
+        flags.isStandardAfterGalaxySpin = state & SpinController::StandardQueued;
+        flags.triggerGalaxySpin = state & SpinController::IsRequested;
+        return flags;
+    }
+
+    bool matches(const SpinController& ctrl) const {
+        return isGalaxySpin == ctrl.isGalaxy() && canGalaxySpin == ctrl.canGalaxy()
+            && canStandardSpin == ctrl.canStandard() && triggerGalaxySpin == ctrl.isRequested()
+            && isGalaxyAfterStandardSpin == SpinController::has(ctrl.getState(), SpinController::GalaxyQueued)
+            && isStandardAfterGalaxySpin == SpinController::has(ctrl.getState(), SpinController::StandardQueued);
+    }
+
+    void send(Event event) {
+        switch (event) {
+            case Event::Reset:  // TryCapSpinPre outside a rethrow
+                canGalaxySpin = true;
+                canStandardSpin = true;
+                isGalaxyAfterStandardSpin = false;
+                isStandardAfterGalaxySpin = false;
+                break;
+            case Event::RequestGalaxy:   triggerGalaxySpin = true; break;
+            case Event::CancelRequest:   triggerGalaxySpin = false; break;
+            case Event::RethrowGalaxy:   isGalaxyAfterStandardSpin = true; break;
+            case Event::RethrowStandard: isStandardAfterGalaxySpin = true; break;
+            case Event::Appear:  // PlayerStateSpinCapAppear
+                if (isGalaxyAfterStandardSpin) {
+                    isGalaxyAfterStandardSpin = false;
+                    canStandardSpin = false;
+                    triggerGalaxySpin = true;
+                }
+                if (isStandardAfterGalaxySpin) {
+                    isStandardAfterGalaxySpin = false;
+                    canGalaxySpin = false;
+                    triggerGalaxySpin = false;
+                }
+                if (!triggerGalaxySpin) {
+                    canStandardSpin = false;
+                    isGalaxySpin = false;
+                    break;
+                }
+                isGalaxySpin = true;
+                canGalaxySpin = false;
+                triggerGalaxySpin = false;
+                break;
+            case Event::SwimStart:  // first step of the swim spin
+                isGalaxySpin = true;
+                triggerGalaxySpin = false;
+                break;
+            case Event::End:  // sensor timer, swim spin end or kill
+                isGalaxySpin = false;
+                break;
+            default: break;
+        }
+    }
+};
+
+struct SpinControllerTest {
+    static void setState(SpinController& ctrl, SpinController::State state) { ctrl.mState = state; }
+};
+
+// Every state against every event
+static int testTable() {
+    for (s32 state = 0; state < SpinController::STATE_NUM; state++) {
+        for (s32 event = 0; event < SpinController::EVENT_NUM; event++) {
+            SpinController ctrl;
+            SpinControllerTest::setState(ctrl, (SpinController::State)state);
+            SpinFlags flags = SpinFlags::fromState((SpinController::State)state);
+
+            ctrl.send((Event)event);
+            flags.send((Event)event);
+            if (!flags.matches(ctrl)) {
+                std::printf("state %02x, event %d: got %02x\n", state, event, ctrl.getState());
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// Long random event sequences from a fresh controller, through
+// requestGalaxy() like TryCapSpinPre does
+static int testSequences() {
+    SpinController ctrl;
+    SpinFlags flags;
+    CHECK(flags.matches(ctrl));
+
+    u32 seed = 1;
+    for (s32 step = 0; step < 100000; step++) {
+        seed = seed * 1664525u + 1013904223u;
+        const Event event = (Event)((seed >> 8) % SpinController::EVENT_NUM);
+
+        if (event == Event::RequestGalaxy) {
+            const bool wasAllowed = flags.canGalaxySpin;
+            CHECK(ctrl.requestGalaxy() == wasAllowed);
+            CHECK(ctrl.isFake() == !wasAllowed);
+            ctrl.clearFake();
+        } else {
+            ctrl.send(event);
+        }
+        flags.send(event);
+        CHECK(flags.matches(ctrl));
+    }
+
+    ctrl.clear();
+    CHECK(SpinFlags().matches(ctrl));
+    return 0;
+}
+
+// Sensor and fake timers, driven from different hooks
+static int testTimers() {
+    SpinController ctrl;
+    ctrl.send(Event::RequestGalaxy);
+    ctrl.send(Event::Appear);
+    CHECK(ctrl.isGalaxy());
+
+    ctrl.startSensor(3);
+    CHECK(ctrl.isBusy());
+    CHECK(!ctrl.tick());
+    CHECK(!ctrl.tick());
+    CHECK(ctrl.tick());
+    CHECK(!ctrl.isGalaxy());
+    CHECK(!ctrl.isBusy());
+
+    // A fake ends on its own counter, one update after reaching zero
+    ctrl.requestFake();
+    CHECK(ctrl.getFake() == SpinController::Fake::Requested);
+    ctrl.startFake(2);
+    CHECK(!ctrl.tickFake());
+    CHECK(!ctrl.tickFake());
+    CHECK(ctrl.tickFake());
+    CHECK(!ctrl.isFake());
+    CHECK(!ctrl.tickFake());
+    return 0;
+}
+
+int main() {
+    if (testTable()) return 1;
+    if (testSequences()) return 1;
+    if (testTimers()) return 1;
+    std::printf("SpinController: ok\n");
+    return 0;
+}
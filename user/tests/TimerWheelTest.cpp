@@ -0,0 +1,77 @@
+#include "Check.h"
+#include "headers/TimerWheel.h"
+
+static constexpr s32 CAPACITY = 40;
+
+// Random schedules and cancels against a plain array of expiry frames.
+// Delays go past the bucket count so timers wrap around the wheel.
+static int testAgainstModel() {
+    static TimerWheel<CAPACITY> wheel;
+    s64 expire[CAPACITY];
+    for (s64& frame : expire) frame = -1;
+    s64 frame = 0;
+    u32 seed = 1;
+    auto next = [&seed] { return (seed = seed * 1664525u + 1013904223u) >> 8; };
+
+    for (s32 step = 0; step < 200000; step++) {
+        const s32 id = next() % CAPACITY;
+        if (next() % 3 == 0) {
+            wheel.cancel(id);
+            expire[id] = -1;
+        } else if (next() & 1) {
+            const s32 delay = next() % 300;
+            wheel.schedule(id, delay);
+            expire[id] = frame + (delay > 0 ? delay : 1);
+        }
+
+        frame++;
+        bool isCorrect = true;
+        wheel.tick([&](s32 fired) {
+            isCorrect &= expire[fired] == frame;
+            expire[fired] = -1;
+        });
+        CHECK(isCorrect);
+
+        for (s32 i = 0; i < CAPACITY; i++) {
+            CHECK(expire[i] < 0 || expire[i] > frame);  // nothing missed
+            CHECK(wheel.isScheduled(i) == (expire[i] >= 0));
+            if (expire[i] >= 0) CHECK(wheel.getRemaining(i) == expire[i] - frame);
+        }
+    }
+    return 0;
+}
+
+// func may cancel or reschedule the id it was handed
+static int testRescheduleInTick() {
+    static TimerWheel<4, 8> wheel;
+    s32 fires[4] = {};
+
+    wheel.schedule(0, 3);
+    wheel.schedule(1, 3);
+    wheel.schedule(2, 11);  // same bucket as 0 and 1, one revolution later
+    for (s32 frame = 1; frame <= 12; frame++) {
+        wheel.tick([&](s32 id) {
+            fires[id]++;
+            if (id == 0 && fires[0] < 3) wheel.schedule(0, 3);
+            if (id == 1) wheel.cancel(1);
+        });
+    }
+    CHECK(fires[0] == 3);  // frames 3, 6, 9
+    CHECK(fires[1] == 1);
+    CHECK(fires[2] == 1);
+    CHECK(!wheel.isScheduled(0) && !wheel.isScheduled(1) && !wheel.isScheduled(2));
+
+    wheel.schedule(3, 5);
+    wheel.clear();
+    CHECK(!wheel.isScheduled(3));
+    wheel.tick([&](s32 id) { fires[id]++; });
+    CHECK(fires[3] == 0);
+    return 0;
+}
+
+int main() {
+    if (testAgainstModel()) return 1;
+    if (testRescheduleInTick()) return 1;
+    std::printf("TimerWheel: ok\n");
+    return 0;
+}